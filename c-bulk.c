@@ -0,0 +1,248 @@
+//
+//  File: %c-bulk.c
+//  Summary: "Bulk conversion between C scalar arrays and wide C types"
+//  Section: ffi
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2014-2017 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Converting an array field like `[int16 [1024]]` one element at a time
+// through get_scalar() and assign_scalar() switches on the field kind and
+// range checks for every element.  These routines do a run of elements of
+// one kind at a time, going through `int64_t` (what an INTEGER! holds) or
+// `double` (what a DECIMAL! holds):
+//
+//     C array => Bulk_Load_Int64() / Bulk_Load_Double() => int64_t / double
+//     int64_t / double => Bulk_Store_Int64() / Bulk_Store_Double() => C array
+//
+// The integer loops are kept branch-free (range checking is a min/max over
+// the run, done before anything is written) so that compilers vectorize
+// them for whatever instruction set they are targeting.  Compilers won't
+// reliably do that for float <=> double, so those have SSE2/AVX and NEON
+// versions, with the plain loop finishing the tail (or doing all of it on
+// other platforms).
+//
+// Callers should use chunks of up to FFI_BULK_CHUNK elements so the wide
+// values fit in a buffer on the C stack.
+//
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define FFI_BULK_AVX
+#elif defined(__SSE2__) || defined(_M_X64) \
+        || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define FFI_BULK_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define FFI_BULK_NEON
+#endif
+
+#include "sys-core.h"
+
+#include "reb-struct.h"
+
+
+#define BULK_WIDEN(T, dest, src, n) \
+    do { \
+        const T *s = cast(const T*, (src)); \
+        REBLEN i; \
+        for (i = 0; i < (n); ++i) \
+            (dest)[i] = s[i]; \
+    } while (0)
+
+#define BULK_NARROW(T, dest, src, n) \
+    do { \
+        T *d = cast(T*, (dest)); \
+        REBLEN i; \
+        for (i = 0; i < (n); ++i) \
+            d[i] = cast(T, (src)[i]); \
+    } while (0)
+
+
+//
+//  Bulk_Load_Int64: C
+//
+// Widen `n` integers of an integral kind to int64_t.  (As with get_scalar(),
+// a uint64 above INT64_MAX comes back negative.)
+//
+void Bulk_Load_Int64(
+    int64_t *dest,
+    const void *src,
+    enum Reb_Field_Kind kind,
+    REBLEN n
+){
+    switch (kind) {
+      case FLD_KIND_UINT8: BULK_WIDEN(uint8_t, dest, src, n); break;
+      case FLD_KIND_INT8: BULK_WIDEN(int8_t, dest, src, n); break;
+      case FLD_KIND_UINT16: BULK_WIDEN(uint16_t, dest, src, n); break;
+      case FLD_KIND_INT16: BULK_WIDEN(int16_t, dest, src, n); break;
+      case FLD_KIND_UINT32: BULK_WIDEN(uint32_t, dest, src, n); break;
+      case FLD_KIND_INT32: BULK_WIDEN(int32_t, dest, src, n); break;
+
+      case FLD_KIND_UINT64:
+      case FLD_KIND_INT64:
+        memcpy(dest, src, n * sizeof(int64_t));
+        break;
+
+      default:
+        panic ("Bulk_Load_Int64() needs an integral field kind");
+    }
+}
+
+
+//
+//  Bulk_Store_Int64: C
+//
+// Narrow `n` integers to an integral kind.  Returns false (having written
+// nothing) if any of them is out of the kind's range.  The checks are the
+// same as assign_scalar()'s, so a uint64 only rules out negative numbers.
+//
+bool Bulk_Store_Int64(
+    void *dest,
+    enum Reb_Field_Kind kind,
+    const int64_t *src,
+    REBLEN n
+){
+    int64_t min;
+    int64_t max;
+    switch (kind) {
+      case FLD_KIND_UINT8: min = 0; max = 0xff; break;
+      case FLD_KIND_INT8: min = -128; max = 0x7f; break;
+      case FLD_KIND_UINT16: min = 0; max = 0xffff; break;
+      case FLD_KIND_INT16: min = -0x8000; max = 0x7fff; break;
+      case FLD_KIND_UINT32: min = 0; max = UINT32_MAX; break;
+      case FLD_KIND_INT32: min = INT32_MIN; max = INT32_MAX; break;
+      case FLD_KIND_UINT64: min = 0; max = INT64_MAX; break;
+      case FLD_KIND_INT64: min = INT64_MIN; max = INT64_MAX; break;
+
+      default:
+        panic ("Bulk_Store_Int64() needs an integral field kind");
+    }
+
+    if (n == 0)
+        return true;
+
+    int64_t lo = src[0];
+    int64_t hi = src[0];
+    REBLEN i;
+    for (i = 1; i < n; ++i) {  // reductions like this vectorize
+        lo = src[i] < lo ? src[i] : lo;
+        hi = src[i] > hi ? src[i] : hi;
+    }
+    if (lo < min or hi > max)
+        return false;
+
+    switch (kind) {
+      case FLD_KIND_UINT8: BULK_NARROW(uint8_t, dest, src, n); break;
+      case FLD_KIND_INT8: BULK_NARROW(int8_t, dest, src, n); break;
+      case FLD_KIND_UINT16: BULK_NARROW(uint16_t, dest, src, n); break;
+      case FLD_KIND_INT16: BULK_NARROW(int16_t, dest, src, n); break;
+      case FLD_KIND_UINT32: BULK_NARROW(uint32_t, dest, src, n); break;
+      case FLD_KIND_INT32: BULK_NARROW(int32_t, dest, src, n); break;
+
+      default:  // 64-bit
+        memcpy(dest, src, n * sizeof(int64_t));
+        break;
+    }
+    return true;
+}
+
+
+//
+//  Bulk_Load_Double: C
+//
+// Widen `n` floats (or copy `n` doubles) to double.
+//
+void Bulk_Load_Double(
+    double *dest,
+    const void *src,
+    enum Reb_Field_Kind kind,
+    REBLEN n
+){
+    if (kind == FLD_KIND_DOUBLE) {
+        memcpy(dest, src, n * sizeof(double));
+        return;
+    }
+
+    assert(kind == FLD_KIND_FLOAT);
+    const float *s = cast(const float*, src);
+
+    REBLEN i = 0;
+
+  #if defined(FFI_BULK_AVX)
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_pd(dest + i, _mm256_cvtps_pd(_mm_loadu_ps(s + i)));
+  #elif defined(FFI_BULK_SSE2)
+    for (; i + 4 <= n; i += 4) {
+        __m128 f = _mm_loadu_ps(s + i);
+        _mm_storeu_pd(dest + i, _mm_cvtps_pd(f));
+        _mm_storeu_pd(dest + i + 2, _mm_cvtps_pd(_mm_movehl_ps(f, f)));
+    }
+  #elif defined(FFI_BULK_NEON)
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t f = vld1q_f32(s + i);
+        vst1q_f64(dest + i, vcvt_f64_f32(vget_low_f32(f)));
+        vst1q_f64(dest + i + 2, vcvt_high_f64_f32(f));
+    }
+  #endif
+
+    for (; i < n; ++i)
+        dest[i] = s[i];
+}
+
+
+//
+//  Bulk_Store_Double: C
+//
+// Narrow `n` doubles to float (rounding like a C cast), or copy them.
+//
+void Bulk_Store_Double(
+    void *dest,
+    enum Reb_Field_Kind kind,
+    const double *src,
+    REBLEN n
+){
+    if (kind == FLD_KIND_DOUBLE) {
+        memcpy(dest, src, n * sizeof(double));
+        return;
+    }
+
+    assert(kind == FLD_KIND_FLOAT);
+    float *d = cast(float*, dest);
+
+    REBLEN i = 0;
+
+  #if defined(FFI_BULK_AVX)
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(d + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+  #elif defined(FFI_BULK_SSE2)
+    for (; i + 4 <= n; i += 4) {
+        __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+        __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+        _mm_storeu_ps(d + i, _mm_movelh_ps(lo, hi));
+    }
+  #elif defined(FFI_BULK_NEON)
+    for (; i + 4 <= n; i += 4) {
+        float32x2_t lo = vcvt_f32_f64(vld1q_f64(src + i));
+        vst1q_f32(d + i, vcvt_high_f32_f64(lo, vld1q_f64(src + i + 2)));
+    }
+  #endif
+
+    for (; i < n; ++i)
+        d[i] = cast(float, src[i]);
+}
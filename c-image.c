@@ -0,0 +1,525 @@
+//
+//  File: %c-image.c
+//  Summary: "Binary images of struct schemas and routine signatures"
+//  Section: ffi
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2014-2017 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A binding is the same set of MAKE-ROUTINE and MAKE STRUCT! specs every time
+// a program starts, but running them means evaluating spec blocks (array
+// dimensions are evaluated, field initializers are reduced, nested structs
+// are made as temporary instances...) and preparing a CIF per routine.  An
+// image holds what those specs produce: the layout of each struct (field
+// names, C types, offsets and dimensions) with its data, and each routine's
+// linker name, ABI and argument schemas.
+//
+// Loading an image builds the schemas directly (they're interned as usual, so
+// they're shared with any struct made from an equivalent spec), and makes the
+// routines lazily--the symbols are looked up and the CIFs are prepared on
+// first call, just as with MAKE-ROUTINE/LAZY.
+//
+// The layout is:
+//
+//     header:  "RFFI" version:u16 pointer-size:u8 byte-order:u8
+//              default-abi:u32 count:u32 body-size:u32 body-hash:u64
+//     body:    count * (tag:u8 name:text entry)
+//
+// Integers are in the byte order of the machine, and text is a u32 size and
+// then UTF-8.  An image is only loaded on a machine whose pointer size, byte
+// order and default ABI match the one that made it, and whose body hashes
+// the same--otherwise it's rejected, and the program should fall back to its
+// specs (and perhaps write a new image).
+//
+
+#include "sys-core.h"
+
+#include "reb-struct.h"
+
+
+#define FFI_IMAGE_VERSION 1
+#define FFI_IMAGE_HEADER_SIZE 28
+
+enum Reb_Image_Tag {
+    IMAGE_TAG_STRUCT = 1,
+    IMAGE_TAG_ROUTINE = 2
+};
+
+enum Reb_Image_Schema {
+    IMAGE_SCHEMA_VOID = 0,  // only for return types
+    IMAGE_SCHEMA_SCALAR = 1,
+    IMAGE_SCHEMA_STRUCT = 2
+};
+
+#define IMAGE_ROUTINE_VARIADIC 0x01
+#define IMAGE_ROUTINE_REENTRANT 0x02
+
+
+inline static REBYTE Native_Byte_Order(void) {
+    const uint16_t probe = 1;
+    return *cast(const REBYTE*, &probe) == 1 ? 1 : 2;  // little or big
+}
+
+static uint64_t Hash_Image_Body(const REBYTE *body, REBLEN size)
+{
+    uint64_t hash = 0xCBF29CE484222325;  // 64-bit FNV-1a
+    REBLEN i;
+    for (i = 0; i < size; ++i) {
+        hash ^= body[i];
+        hash *= 0x100000001B3;
+    }
+    return hash;
+}
+
+
+//=//// WRITING ///////////////////////////////////////////////////////////=//
+
+static void Put_Bytes(REBBIN *bin, const void *p, REBLEN size)
+{
+    REBLEN old_len = BIN_LEN(bin);
+    EXPAND_SERIES_TAIL(bin, size);
+    memcpy(BIN_HEAD(bin) + old_len, p, size);
+}
+
+inline static void Put_U8(REBBIN *bin, REBYTE u)
+    { Put_Bytes(bin, &u, 1); }
+
+inline static void Put_U32(REBBIN *bin, uint32_t u)
+    { Put_Bytes(bin, &u, sizeof(u)); }
+
+inline static void Put_U64(REBBIN *bin, uint64_t u)
+    { Put_Bytes(bin, &u, sizeof(u)); }
+
+static void Put_Text(REBBIN *bin, const char *utf8)
+{
+    REBLEN size = strlen(utf8);
+    Put_U32(bin, size);
+    Put_Bytes(bin, utf8, size);
+}
+
+inline static void Put_Symbol(REBBIN *bin, const REBSTR *symbol)
+    { Put_Text(bin, STR_UTF8(symbol)); }
+
+
+// A struct is its size and its fields.  Fields of struct type nest their
+// layout in place, so the reader never has to resolve a reference.
+//
+static void Put_Layout(REBBIN *bin, REBARR *fieldlist, REBLEN wide)
+{
+    Put_U32(bin, wide);
+    Put_U32(bin, ARR_LEN(fieldlist));
+
+    const RELVAL *tail = ARR_TAIL(fieldlist);
+    const RELVAL *item = ARR_HEAD(fieldlist);
+    for (; item != tail; ++item) {
+        REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(item);
+
+        Put_Symbol(bin, FLD_NAME(field));
+        Put_U32(bin, FLD_OFFSET(field));
+
+        if (FLD_IS_ARRAY(field)) {
+            Put_U8(bin, 1);
+            Put_U32(bin, FLD_DIMENSION(field));
+        }
+        else
+            Put_U8(bin, 0);
+
+        if (FLD_IS_STRUCT(field)) {
+            Put_U8(bin, IMAGE_SCHEMA_STRUCT);
+            Put_Layout(bin, FLD_FIELDLIST(field), FLD_WIDE(field));
+        }
+        else {
+            Put_U8(bin, IMAGE_SCHEMA_SCALAR);
+            Put_Symbol(bin, VAL_WORD_SYMBOL(FLD_AT(field, IDX_FIELD_TYPE)));
+        }
+    }
+}
+
+static void Put_Schema(REBBIN *bin, const RELVAL *schema)
+{
+    if (IS_BLANK(schema))
+        Put_U8(bin, IMAGE_SCHEMA_VOID);
+    else if (IS_BLOCK(schema)) {
+        REBFLD *fld = VAL_ARRAY_KNOWN_MUTABLE(schema);
+        Put_U8(bin, IMAGE_SCHEMA_STRUCT);
+        Put_Layout(bin, FLD_FIELDLIST(fld), FLD_WIDE(fld));
+    }
+    else {
+        Put_U8(bin, IMAGE_SCHEMA_SCALAR);
+        Put_Symbol(bin, VAL_WORD_SYMBOL(schema));
+    }
+}
+
+static void Put_Routine(REBBIN *bin, const REBVAL *routine)
+{
+    REBACT *act = VAL_ACTION(routine);
+    REBRIN *r = ACT_DETAILS(act);
+
+    if (RIN_IS_CALLBACK(r) or not IS_TEXT(RIN_AT(r, IDX_ROUTINE_NAME)))
+        fail ("FFI: Images only hold routines made with MAKE-ROUTINE");
+
+    if (RIN_HAS_CONVERSIONS(r))
+        fail ("FFI: Images can't hold routines with out or text parameters");
+
+    Put_Text(bin, cs_cast(VAL_UTF8_AT(RIN_AT(r, IDX_ROUTINE_NAME))));
+    Put_U32(bin, RIN_ABI(r));
+
+    REBYTE flags = 0;
+    if (RIN_IS_VARIADIC(r))
+        flags |= IMAGE_ROUTINE_VARIADIC;
+    if (RIN_IS_REENTRANT(r))
+        flags |= IMAGE_ROUTINE_REENTRANT;
+    Put_U8(bin, flags);
+
+    REBLEN num_fixed = RIN_NUM_FIXED_ARGS(r);
+    Put_U32(bin, num_fixed);
+
+    REBLEN i;
+    for (i = 0; i < num_fixed; ++i) {
+        Put_Symbol(bin, KEY_SYMBOL(ACT_KEY(act, i + 1)));  // 1-based
+        Put_Schema(bin, RIN_ARG_SCHEMA(r, i));
+    }
+
+    Put_Schema(bin, RIN_RET_SCHEMA(r));
+}
+
+
+//
+//  Encode_Ffi_Image: C
+//
+// `entries` alternates WORD! names with the routines and structs to save.
+// A struct's data is saved along with its layout (copied out of wherever it
+// lives, so a struct made on raw memory loads as an ordinary struct).
+//
+REBVAL *Encode_Ffi_Image(REBVAL *out, const REBVAL *entries)
+{
+    REBBIN *bin = Make_Binary(FFI_IMAGE_HEADER_SIZE + 256);
+
+    const char magic[4] = {'R', 'F', 'F', 'I'};
+    Put_Bytes(bin, magic, 4);
+    uint16_t version = FFI_IMAGE_VERSION;
+    Put_Bytes(bin, &version, sizeof(version));
+    Put_U8(bin, sizeof(void*));
+    Put_U8(bin, Native_Byte_Order());
+    Put_U32(bin, FFI_DEFAULT_ABI);
+    Put_U32(bin, 0);  // count, filled in at the end
+    Put_U32(bin, 0);  // body size, "
+    Put_U64(bin, 0);  // body hash, "
+    assert(BIN_LEN(bin) == FFI_IMAGE_HEADER_SIZE);
+
+    uint32_t count = 0;
+
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, entries);
+    for (; item != tail; item += 2, ++count) {
+        if (not IS_WORD(item) or item + 1 == tail)
+            fail ("FFI: Image entries must be pairs of WORD! and value");
+
+        DECLARE_LOCAL (value);
+        Derelativize(value, item + 1, VAL_SPECIFIER(entries));
+
+        if (IS_STRUCT(value)) {
+            if (VAL_STRUCT_INACCESSIBLE(value))
+                fail ("FFI: Struct in image entries has no accessible data");
+            if (STU_IS_ARRAY(VAL_STRUCT(value)))
+                fail ("FFI: Images don't hold struct arrays");
+
+            Put_U8(bin, IMAGE_TAG_STRUCT);
+            Put_Symbol(bin, VAL_WORD_SYMBOL(item));
+
+            REBFLD *schema = VAL_STRUCT_SCHEMA(value);
+            Put_Layout(bin, FLD_FIELDLIST(schema), FLD_WIDE(schema));
+            Put_U32(bin, VAL_STRUCT_SIZE(value));
+
+            // The data pointer is fetched after the puts above, which can
+            // grow `bin`...but never move the struct's own data.
+            //
+            Put_Bytes(bin, VAL_STRUCT_DATA_AT(value), VAL_STRUCT_SIZE(value));
+        }
+        else if (IS_ACTION(value) and IS_ACTION_RIN(value)) {
+            Put_U8(bin, IMAGE_TAG_ROUTINE);
+            Put_Symbol(bin, VAL_WORD_SYMBOL(item));
+            Put_Routine(bin, value);
+        }
+        else
+            fail ("FFI: Images only hold routines and STRUCT!s");
+    }
+
+    REBYTE *head = BIN_HEAD(bin);
+    uint32_t body_size = BIN_LEN(bin) - FFI_IMAGE_HEADER_SIZE;
+    uint64_t hash = Hash_Image_Body(head + FFI_IMAGE_HEADER_SIZE, body_size);
+    memcpy(head + 12, &count, sizeof(count));
+    memcpy(head + 16, &body_size, sizeof(body_size));
+    memcpy(head + 20, &hash, sizeof(hash));
+
+    TERM_BIN(bin);
+    return Init_Binary(out, bin);
+}
+
+
+//=//// READING ///////////////////////////////////////////////////////////=//
+
+struct Reb_Image_Reader {
+    const REBYTE *at;
+    const REBYTE *tail;
+};
+
+static const REBYTE *Take_Bytes(struct Reb_Image_Reader *rd, REBLEN size)
+{
+    if (cast(REBLEN, rd->tail - rd->at) < size)
+        fail ("FFI: Binding image is truncated");
+    const REBYTE *bytes = rd->at;
+    rd->at += size;
+    return bytes;
+}
+
+inline static REBYTE Take_U8(struct Reb_Image_Reader *rd)
+    { return *Take_Bytes(rd, 1); }
+
+inline static uint32_t Take_U32(struct Reb_Image_Reader *rd) {
+    uint32_t u;
+    memcpy(&u, Take_Bytes(rd, sizeof(u)), sizeof(u));
+    return u;
+}
+
+inline static uint64_t Take_U64(struct Reb_Image_Reader *rd) {
+    uint64_t u;
+    memcpy(&u, Take_Bytes(rd, sizeof(u)), sizeof(u));
+    return u;
+}
+
+static const REBSTR *Take_Symbol(struct Reb_Image_Reader *rd)
+{
+    uint32_t size = Take_U32(rd);
+    return Intern_UTF8_Managed(Take_Bytes(rd, size), size);
+}
+
+static REBFLD *Take_Layout(struct Reb_Image_Reader *rd)
+{
+    uint32_t wide = Take_U32(rd);
+    uint32_t num_fields = Take_U32(rd);
+
+    REBDSP dsp_orig = DSP;  // accumulate the fields like MAKE_Struct() does
+
+    uint32_t n;
+    for (n = 0; n < num_fields; ++n) {
+        const REBSTR *name = Take_Symbol(rd);
+        uint32_t offset = Take_U32(rd);
+        bool is_array = (Take_U8(rd) != 0);
+        uint32_t dimension = is_array ? Take_U32(rd) : 1;
+
+        // A nested struct's schema is made before the field, so the field
+        // is never unmanaged while that runs.  It's kept on the stack until
+        // the field refers to it.
+        //
+        REBFLD *inner = nullptr;
+        SYMID sym = SYM_0;
+        REBYTE kind = Take_U8(rd);
+        if (kind == IMAGE_SCHEMA_STRUCT) {
+            inner = Take_Layout(rd);
+            Init_Block(DS_PUSH(), inner);
+        }
+        else if (kind == IMAGE_SCHEMA_SCALAR)
+            sym = ID_OF_SYMBOL(Take_Symbol(rd));
+        else
+            fail ("FFI: Binding image has a bad field type");
+
+        REBFLD *field = Make_Field(name, offset);
+        if (inner) {
+            Init_Struct_Field_Type(field, inner, FLD_WIDE(inner));
+            DS_DROP();
+        }
+        else if (not Init_Scalar_Field_Type(field, sym))
+            fail ("FFI: Binding image has an unknown C type");
+
+        if (is_array)
+            Init_Integer(FLD_AT(field, IDX_FIELD_DIMENSION), dimension);
+        else
+            Init_Blank(FLD_AT(field, IDX_FIELD_DIMENSION));
+
+        uint64_t end = offset + cast(uint64_t, FLD_WIDE(field)) * dimension;
+        if (end > wide)
+            fail ("FFI: Binding image has a field outside of its struct");
+
+        Init_Block(DS_PUSH(), field);
+    }
+
+    REBARR *fieldlist = Pop_Stack_Values_Core(dsp_orig, NODE_FLAG_MANAGED);
+    return Make_Struct_Schema(fieldlist, wide);
+}
+
+static void Take_Schema(RELVAL *out, struct Reb_Image_Reader *rd)
+{
+    switch (Take_U8(rd)) {
+      case IMAGE_SCHEMA_VOID:
+        Init_Blank(out);
+        break;
+
+      case IMAGE_SCHEMA_SCALAR: {
+        const REBSTR *symbol = Take_Symbol(rd);
+        if (Get_FFType_For_Sym(ID_OF_SYMBOL(symbol)) == nullptr)
+            fail ("FFI: Binding image has an unknown C type");
+        Init_Word(out, symbol);
+        break; }
+
+      case IMAGE_SCHEMA_STRUCT:
+        Init_Block(out, Take_Layout(rd));
+        break;
+
+      default:
+        fail ("FFI: Binding image has a bad argument type");
+    }
+}
+
+static REBACT *Take_Routine(struct Reb_Image_Reader *rd, const REBVAL *lib)
+{
+    uint32_t name_size = Take_U32(rd);
+    const REBYTE *name_utf8 = Take_Bytes(rd, name_size);
+    ffi_abi abi = cast(ffi_abi, Take_U32(rd));
+    REBYTE flags = Take_U8(rd);
+    uint32_t num_fixed = Take_U32(rd);
+
+    // Guarded like in Alloc_Ffi_Action_For_Spec(), since making the schemas
+    // of struct arguments allocates.
+    //
+    REBARR *args_schemas = Make_Array(num_fixed);
+    Manage_Series(args_schemas);
+    PUSH_GC_GUARD(args_schemas);
+
+    const REBSTR **arg_names = rebAllocN(const REBSTR*, num_fixed + 1);
+
+    uint32_t i;
+    for (i = 0; i < num_fixed; ++i) {
+        arg_names[i] = Take_Symbol(rd);
+        Take_Schema(Alloc_Tail_Array(args_schemas), rd);
+        if (IS_BLANK(ARR_LAST(args_schemas)))
+            fail ("FFI: void is only legal as a return type");
+    }
+
+    DECLARE_LOCAL (ret_schema);
+    Init_Blank(ret_schema);
+    PUSH_GC_GUARD(ret_schema);
+    Take_Schema(ret_schema, rd);
+
+    REBACT *routine = Alloc_Ffi_Action_For_Schemas(
+        args_schemas,
+        arg_names,
+        ret_schema,
+        abi,
+        did (flags & IMAGE_ROUTINE_VARIADIC),
+        did (flags & IMAGE_ROUTINE_REENTRANT),
+        true  // lazy, see Bind_Lazy_Routine()
+    );
+
+    DROP_GC_GUARD(ret_schema);
+    DROP_GC_GUARD(args_schemas);
+    rebFree(arg_names);
+
+    REBRIN *r = ACT_DETAILS(routine);
+
+    REBVAL *name = rebSizedText(cs_cast(name_utf8), name_size);
+    Copy_Cell(RIN_AT(r, IDX_ROUTINE_NAME), name);
+    rebRelease(name);
+
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_CFUNC));  // looked up on first call
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_CLOSURE));
+    Copy_Cell(RIN_AT(r, IDX_ROUTINE_ORIGIN), lib);
+
+    return routine;
+}
+
+
+//
+//  Decode_Ffi_Image: C
+//
+// Gives back a BLOCK! alternating WORD! names with the routines and structs
+// from the image.  The routines are bound to functions in `lib` when first
+// called.
+//
+REBVAL *Decode_Ffi_Image(REBVAL *out, const REBVAL *image, const REBVAL *lib)
+{
+    REBSIZ size;
+    const REBYTE *head = VAL_BYTES_AT(&size, image);
+
+    struct Reb_Image_Reader rd;
+    rd.at = head;
+    rd.tail = head + size;
+
+    const REBYTE *magic = Take_Bytes(&rd, 4);
+    if (0 != memcmp(magic, "RFFI", 4))
+        fail ("FFI: Not a binding image");
+
+    uint16_t version;
+    memcpy(&version, Take_Bytes(&rd, sizeof(version)), sizeof(version));
+    if (version != FFI_IMAGE_VERSION)
+        fail ("FFI: Binding image is from a different version of the FFI");
+
+    REBYTE pointer_size = Take_U8(&rd);
+    REBYTE byte_order = Take_U8(&rd);
+    uint32_t default_abi = Take_U32(&rd);
+    if (
+        pointer_size != sizeof(void*)
+        or byte_order != Native_Byte_Order()
+        or default_abi != FFI_DEFAULT_ABI
+    ){
+        fail ("FFI: Binding image was made for a different platform");
+    }
+
+    uint32_t count = Take_U32(&rd);
+    uint32_t body_size = Take_U32(&rd);
+    uint64_t hash = Take_U64(&rd);
+    assert(rd.at == head + FFI_IMAGE_HEADER_SIZE);
+
+    if (cast(REBLEN, rd.tail - rd.at) != body_size)
+        fail ("FFI: Binding image is truncated");
+    if (Hash_Image_Body(rd.at, body_size) != hash)
+        fail ("FFI: Binding image is corrupt");
+
+    REBDSP dsp_orig = DSP;
+
+    uint32_t n;
+    for (n = 0; n < count; ++n) {
+        REBYTE tag = Take_U8(&rd);
+        Init_Word(DS_PUSH(), Take_Symbol(&rd));
+
+        if (tag == IMAGE_TAG_STRUCT) {
+            REBFLD *schema = Take_Layout(&rd);
+            Init_Block(DS_PUSH(), schema);  // keep it alive for the struct
+
+            uint32_t data_size = Take_U32(&rd);
+            if (data_size != FLD_WIDE(schema))
+                fail ("FFI: Binding image has struct data of the wrong size");
+
+            Init_Struct_For_Schema(
+                DS_TOP,  // overwrites the schema's block
+                schema,
+                Take_Bytes(&rd, data_size)
+            );
+        }
+        else if (tag == IMAGE_TAG_ROUTINE) {
+            REBACT *routine = Take_Routine(&rd, lib);
+            Init_Action(DS_PUSH(), routine, ANONYMOUS, UNBOUND);
+        }
+        else
+            fail ("FFI: Binding image has an unknown kind of entry");
+    }
+
+    if (rd.at != rd.tail)
+        fail ("FFI: Binding image has data after its last entry");
+
+    return Init_Block(out, Pop_Stack_Values(dsp_orig));
+}
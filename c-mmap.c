@@ -0,0 +1,422 @@
+//
+//  File: %c-mmap.c
+//  Summary: "Memory-mapped files as the storage of STRUCT!s"
+//  Section: ffi
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2014-2017 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A file of fixed-layout C records can be used directly as the storage of a
+// STRUCT! (or a struct array), instead of being read into a BINARY! and then
+// copied.  The pages are only read in as they are touched, so a file can be
+// far bigger than what would fit in memory.
+//
+// This builds on external storage (like `raw-memory:`), where the struct's
+// data is a managed HANDLE! with a pointer.  Here the HANDLE!'s cleanup
+// unmaps the file when the struct is GC'd.  UNMAP-STRUCT can do that sooner,
+// leaving the struct inaccessible just like DESTROY-STRUCT-STORAGE does.
+//
+// Since the system needs the start of a mapping (which must be aligned to a
+// page, or on Windows a 64K "allocation granularity") to unmap it, the maps
+// that are live are kept in a list by the address the struct data starts at.
+//
+
+#if defined(TO_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #undef IS_ERROR  // %windows.h defines this, but so does Ren-C
+#else
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "sys-core.h"
+
+#include "reb-struct.h"
+
+
+struct Reb_File_Map {
+    REBYTE *data;  // what the struct's HANDLE! points to
+    void *base;  // what the system gave back, aligned
+    REBU64 map_len;  // from `base`
+  #if defined(TO_WINDOWS)
+    HANDLE file;  // FlushFileBuffers() needs it, see Flush_Struct_Map()
+    bool write;  // ...and only works if the file was opened for writing
+  #endif
+    struct Reb_File_Map *next;
+};
+
+static struct Reb_File_Map *File_Maps = nullptr;
+
+
+static struct Reb_File_Map **Find_File_Map(const REBYTE *data)
+{
+    struct Reb_File_Map **link = &File_Maps;
+    for (; *link != nullptr; link = &(*link)->next) {
+        if ((*link)->data == data)
+            return link;
+    }
+    return nullptr;
+}
+
+
+static void Unmap_File_Map(struct Reb_File_Map **link)
+{
+    struct Reb_File_Map *map = *link;
+    *link = map->next;
+
+  #if defined(TO_WINDOWS)
+    UnmapViewOfFile(map->base);
+    CloseHandle(map->file);
+  #else
+    munmap(map->base, cast(size_t, map->map_len));
+  #endif
+
+    FREE(struct Reb_File_Map, map);
+}
+
+
+// The HANDLE! is shared by every STRUCT! value (and view) of the mapping,
+// so once UNMAP-STRUCT zeroes its length none of them will unmap again.
+// (Which matters, since a new mapping might be at the same address.)
+//
+static void cleanup_mapped_file(const REBVAL *v) {
+    if (VAL_HANDLE_LEN(v) == 0)
+        return;
+
+    struct Reb_File_Map **link = Find_File_Map(VAL_HANDLE_POINTER(REBYTE, v));
+    if (link)
+        Unmap_File_Map(link);
+}
+
+
+static REBVAL *Mapped_Handle(const REBVAL *stu_value)
+{
+    REBVAL *data = VAL_STRUCT_DATA(stu_value);
+    if (
+        not IS_HANDLE(data)
+        or VAL_HANDLE_LEN(data) == 0
+        or Find_File_Map(VAL_HANDLE_POINTER(REBYTE, data)) == nullptr
+    ){
+        fail ("FFI: STRUCT! is not (or is no longer) mapped onto a file");
+    }
+    return data;
+}
+
+
+#if !defined(TO_WINDOWS)
+    static int Madvise_From_Word(const REBVAL *word)
+    {
+        if (Word_Is_Spelled(word, "normal"))
+            return MADV_NORMAL;
+        if (Word_Is_Spelled(word, "sequential"))
+            return MADV_SEQUENTIAL;
+        if (Word_Is_Spelled(word, "random"))
+            return MADV_RANDOM;
+        if (Word_Is_Spelled(word, "willneed"))
+            return MADV_WILLNEED;
+        if (Word_Is_Spelled(word, "dontneed"))
+            return MADV_DONTNEED;
+
+        fail (word);
+    }
+#endif
+
+
+// Making the STRUCT! for a map can fail (e.g. out of memory) once the file is
+// mapped, so it's done under rebRescue() to unmap it if so.
+//
+struct Reb_Mapped_Struct_Params {
+    REBVAL *out;
+    REBSTU *element;
+    REBLEN num;  // 0 for a single struct, else the records in the array
+    REBYTE *data;
+    REBLEN len;
+};
+
+static REBVAL *Make_Mapped_Struct(struct Reb_Mapped_Struct_Params *p)
+{
+    // Make the struct with a pointer to the data first, and then give it the
+    // HANDLE! that unmaps on GC.
+    //
+    REBSTU *stu;
+    if (p->num != 0) {
+        Init_Struct_Array(
+            p->out,
+            p->element,
+            p->num,
+            0,  // records are packed
+            cast(uintptr_t, p->data)
+        );
+        stu = VAL_STRUCT(p->out);
+    }
+    else {
+        stu = Copy_Struct_Managed(p->element, false);
+        Init_Struct(p->out, stu);
+    }
+
+    Init_Handle_Cdata_Managed(
+        ARR_SINGLE(stu),
+        p->data,
+        p->len,
+        &cleanup_mapped_file
+    );
+
+    return nullptr;  // no error
+}
+
+
+//
+//  Map_Struct_File: C
+//
+// Map `path` starting at byte `offset`, and put a STRUCT! using it in `out`.
+// If `count` is null it's a single struct like `element`, else an array of
+// that many elements (with 0 meaning as many whole elements as there are).
+//
+// Without `write` the map is private: the file is only opened for reading,
+// and writes to the struct just make private copies of the pages touched.
+//
+// !!! That isn't a read-only map.  A STRUCT! has no way to refuse writes, so
+// one on pages mapped without PROT_WRITE would crash the first time it was
+// written.  Private copy-on-write keeps the file from being changed instead.
+//
+REBVAL *Map_Struct_File(
+    REBVAL *out,
+    REBSTU *element,
+    const REBVAL *path,
+    REBI64 offset,
+    option(const REBVAL*) count,
+    bool write,
+    option(const REBVAL*) advise
+){
+    if (STU_IS_ARRAY(element))
+        fail ("FFI: Can't map a struct array, give the element struct");
+
+    if (STU_INACCESSIBLE(element))
+        fail ("FFI: Can't map a file using an inaccessible STRUCT!");
+
+    if (offset < 0)
+        fail ("FFI: File map offset can't be negative");
+
+    REBLEN stride = STU_SIZE(element);
+    if (stride == 0)
+        fail ("FFI: Can't map a zero-size struct");
+
+  #if defined(TO_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    REBI64 granularity = info.dwAllocationGranularity;
+
+    char *local = rebSpell("file-to-local/full", path);
+    HANDLE file = CreateFileA(
+        local,
+        write ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr
+    );
+    rebFree(local);
+    if (file == INVALID_HANDLE_VALUE)
+        rebFail_OS (GetLastError());
+
+    LARGE_INTEGER size;
+    if (not GetFileSizeEx(file, &size)) {
+        DWORD err = GetLastError();
+        CloseHandle(file);
+        rebFail_OS (err);
+    }
+    REBI64 file_size = size.QuadPart;
+  #else
+    REBI64 granularity = sysconf(_SC_PAGESIZE);
+
+    int advice = -1;  // checked before anything needs to be cleaned up
+    if (advise)
+        advice = Madvise_From_Word(unwrap(advise));
+
+    char *local = rebSpell("file-to-local/full", path);
+    int fd = open(local, write ? O_RDWR : O_RDONLY);
+    rebFree(local);
+    if (fd < 0)
+        rebFail_OS (errno);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        close(fd);
+        rebFail_OS (err);
+    }
+    REBI64 file_size = st.st_size;
+  #endif
+
+    REBI64 num = count ? VAL_INT64(unwrap(count)) : 1;
+    if (count and num == 0)
+        num = (file_size > offset) ? (file_size - offset) / stride : 0;
+
+    REBI64 len = 0;  // checked before multiplying, so it can't overflow
+    const char *error = nullptr;
+    if (num <= 0 or num > cast(REBI64, VAL_STRUCT_LIMIT / stride))
+        error = "FFI: Bad number of records for map of file";
+    else {
+        len = num * stride;
+        if (offset > file_size or len > file_size - offset)
+            error = "FFI: File is too short for the requested map";
+    }
+
+    if (error) {
+      #if defined(TO_WINDOWS)
+        CloseHandle(file);
+      #else
+        close(fd);
+      #endif
+        fail (error);
+    }
+
+    REBI64 delta = offset % granularity;  // map from an aligned offset
+    REBU64 map_len = cast(REBU64, delta + len);
+
+  #if defined(TO_WINDOWS)
+    HANDLE mapping = CreateFileMappingA(
+        file,
+        nullptr,
+        write ? PAGE_READWRITE : PAGE_WRITECOPY,
+        0,
+        0,  // the whole file
+        nullptr
+    );
+    DWORD err = GetLastError();
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        rebFail_OS (err);
+    }
+
+    REBU64 map_offset = cast(REBU64, offset - delta);
+    void *base = MapViewOfFile(
+        mapping,
+        write ? FILE_MAP_WRITE : FILE_MAP_COPY,
+        cast(DWORD, map_offset >> 32),
+        cast(DWORD, map_offset & 0xFFFFFFFF),
+        cast(SIZE_T, map_len)
+    );
+    err = GetLastError();
+    CloseHandle(mapping);  // the view keeps the mapping
+    if (base == nullptr) {
+        CloseHandle(file);
+        rebFail_OS (err);
+    }
+
+    UNUSED(advise);  // !!! PrefetchVirtualMemory() could do WILLNEED
+  #else
+    void *base = mmap(
+        nullptr,
+        cast(size_t, map_len),
+        PROT_READ | PROT_WRITE,
+        write ? MAP_SHARED : MAP_PRIVATE,
+        fd,
+        cast(off_t, offset - delta)
+    );
+    int err = errno;
+    close(fd);  // the mapping keeps the file open
+    if (base == MAP_FAILED)
+        rebFail_OS (err);
+
+    if (advice != -1)
+        madvise(base, cast(size_t, map_len), advice);
+  #endif
+
+    struct Reb_File_Map *map = TRY_ALLOC(struct Reb_File_Map);
+    if (map == nullptr) {
+      #if defined(TO_WINDOWS)
+        UnmapViewOfFile(base);
+        CloseHandle(file);
+      #else
+        munmap(base, cast(size_t, map_len));
+      #endif
+        fail (Error_No_Memory(sizeof(struct Reb_File_Map)));
+    }
+
+    map->data = cast(REBYTE*, base) + delta;
+    map->base = base;
+    map->map_len = map_len;
+  #if defined(TO_WINDOWS)
+    map->file = file;  // kept open while mapped, so it can be flushed
+    map->write = write;
+  #endif
+    map->next = File_Maps;
+    File_Maps = map;
+
+    struct Reb_Mapped_Struct_Params params;
+    params.out = out;
+    params.element = element;
+    params.num = count ? cast(REBLEN, num) : 0;
+    params.data = map->data;
+    params.len = cast(REBLEN, len);
+
+    REBVAL *error_value = rebRescue(
+        cast(REBDNG*, &Make_Mapped_Struct),
+        &params
+    );
+    if (error_value) {  // nothing has the HANDLE! that would unmap it
+        Unmap_File_Map(Find_File_Map(params.data));
+        rebJumps ("fail", rebR(error_value));
+    }
+
+    return out;
+}
+
+
+//
+//  Flush_Struct_Map: C
+//
+// Write modified pages of a WRITE map back to the file, waiting until done.
+//
+void Flush_Struct_Map(const REBVAL *stu_value)
+{
+    REBVAL *data = Mapped_Handle(stu_value);
+    struct Reb_File_Map *map = *Find_File_Map(
+        VAL_HANDLE_POINTER(REBYTE, data)
+    );
+
+  #if defined(TO_WINDOWS)
+    //
+    // FlushViewOfFile() only starts writing the pages back, so waiting for
+    // them to reach the disk (as `msync(MS_SYNC)` does) takes the file.
+    //
+    if (not FlushViewOfFile(map->base, cast(SIZE_T, map->map_len)))
+        rebFail_OS (GetLastError());
+    if (map->write and not FlushFileBuffers(map->file))
+        rebFail_OS (GetLastError());
+  #else
+    if (msync(map->base, cast(size_t, map->map_len), MS_SYNC) != 0)
+        rebFail_OS (errno);
+  #endif
+}
+
+
+//
+//  Unmap_Struct: C
+//
+void Unmap_Struct(const REBVAL *stu_value)
+{
+    REBVAL *data = Mapped_Handle(stu_value);
+    Unmap_File_Map(Find_File_Map(VAL_HANDLE_POINTER(REBYTE, data)));
+    SET_HANDLE_LEN(data, 0);  // makes the struct inaccessible
+}
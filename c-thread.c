@@ -0,0 +1,748 @@
+//
+//  File: %c-thread.c
+//  Summary: "FFI callbacks from foreign threads, and worker threads"
+//  Section: ffi
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2014-2017 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// An ordinary callback runs the Rebol action right inside the C code that
+// called it.  That's only legal on the interpreter's own thread, and plenty
+// of libraries (audio engines, network event loops) call back from threads
+// of their own.
+//
+// A callback made with WRAP-CALLBACK/FOREIGN instead copies the C argument
+// bytes into a message and posts it to a queue, which the interpreter drains
+// with PUMP-CALLBACKS.  A void callback returns to the foreign thread right
+// away.  Otherwise the foreign thread waits for the interpreter to write
+// the return value back into the message.
+//
+// The foreign side must not touch anything the interpreter owns--not even
+// its memory allocator--so messages are plain malloc() blocks, and all the
+// thread knows about the callback is a Reb_Foreign_Callback it was given at
+// the time the closure was made.
+//
+// Going the other direction, pools of worker threads can run C calls away
+// from the interpreter, so blocking ones don't stall it and batches of them
+// can use all the cores.
+//
+
+#if defined(TO_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #undef IS_ERROR  // %windows.h defines this, but so does Ren-C
+#else
+    #include <pthread.h>
+    #include <sched.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
+#include "sys-core.h"
+
+#include "reb-struct.h"
+#include "reb-thread.h"
+
+
+//=//// THREAD PRIMITIVES /////////////////////////////////////////////////=//
+
+#if defined(TO_WINDOWS)
+    static DWORD Interpreter_Thread;
+
+    bool On_Interpreter_Thread(void)
+        { return GetCurrentThreadId() == Interpreter_Thread; }
+
+    void Ffi_Yield_Thread(void)
+        { SwitchToThread(); }
+
+    static void Note_Interpreter_Thread(void)
+        { Interpreter_Thread = GetCurrentThreadId(); }
+
+    REBI64 Ffi_Nanoseconds(void) {
+        static LARGE_INTEGER frequency;  // fixed at boot, per the docs
+        if (frequency.QuadPart == 0)
+            QueryPerformanceFrequency(&frequency);
+
+        LARGE_INTEGER count;
+        QueryPerformanceCounter(&count);
+        return (count.QuadPart / frequency.QuadPart) * 1000000000
+            + (count.QuadPart % frequency.QuadPart) * 1000000000
+                / frequency.QuadPart;
+    }
+#else
+    static pthread_t Interpreter_Thread;
+
+    bool On_Interpreter_Thread(void)
+        { return 0 != pthread_equal(pthread_self(), Interpreter_Thread); }
+
+    void Ffi_Yield_Thread(void)
+        { sched_yield(); }
+
+    static void Note_Interpreter_Thread(void)
+        { Interpreter_Thread = pthread_self(); }
+
+    REBI64 Ffi_Nanoseconds(void) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return cast(REBI64, ts.tv_sec) * 1000000000 + ts.tv_nsec;
+    }
+#endif
+
+
+//=//// FOREIGN CALLBACK QUEUE ////////////////////////////////////////////=//
+//
+// Any number of foreign threads may post calls, but only the interpreter
+// takes them out.  That's the multi-producer single-consumer case, which a
+// bounded ring can handle without locks (this is Dmitry Vyukov's design).
+//
+// Each slot has a sequence number.  A producer that has claimed position
+// `pos` may fill the slot once its sequence equals `pos`, and publishes it
+// by setting the sequence to `pos + 1`.  The consumer takes the slot when it
+// sees `pos + 1`, and hands it back for the next lap of the ring by setting
+// it to `pos + FFI_FOREIGN_QUEUE_SIZE`.
+//
+// When the ring is full producers yield until the interpreter catches up,
+// rather than dropping the call.
+//
+
+#define FFI_FOREIGN_QUEUE_SIZE 1024  // must be a power of 2
+#define FFI_FOREIGN_STORE_ALIGN 16  // at least the alignment of any C type
+
+struct Reb_Foreign_Call {
+    struct Reb_Foreign_Callback *callback;
+    volatile uintptr_t done;  // set once the return value has been written
+    REBYTE *store;  // laid out by RIN_LAYOUT, follows the `args` pointers
+    void *args[1];  // actually `num_args` pointers into the store
+};
+
+struct Reb_Foreign_Queue_Slot {
+    volatile uintptr_t sequence;
+    struct Reb_Foreign_Call *call;
+};
+
+static struct Reb_Foreign_Queue_Slot Foreign_Queue[FFI_FOREIGN_QUEUE_SIZE];
+static volatile uintptr_t Foreign_Enqueue_Pos;
+static uintptr_t Foreign_Dequeue_Pos;  // only the interpreter touches this
+static bool Foreign_Queue_Started = false;
+
+
+static void Enqueue_Foreign_Call(struct Reb_Foreign_Call *call)
+{
+    uintptr_t pos = Atomic_Load_Acquire(&Foreign_Enqueue_Pos);
+
+    while (true) {
+        struct Reb_Foreign_Queue_Slot *slot
+            = &Foreign_Queue[pos & (FFI_FOREIGN_QUEUE_SIZE - 1)];
+
+        intptr_t diff = cast(intptr_t, Atomic_Load_Acquire(&slot->sequence))
+            - cast(intptr_t, pos);
+
+        if (diff == 0) {  // slot is free for this lap, try to claim `pos`
+            if (Atomic_Compare_Exchange(&Foreign_Enqueue_Pos, &pos, pos + 1)) {
+                slot->call = call;
+                Atomic_Store_Release(&slot->sequence, pos + 1);
+                return;
+            }
+            // failed exchange updated `pos` to what another producer left
+        }
+        else if (diff < 0) {  // ring is full, wait for the interpreter
+            Ffi_Yield_Thread();
+            pos = Atomic_Load_Acquire(&Foreign_Enqueue_Pos);
+        }
+        else  // another producer claimed `pos` first
+            pos = Atomic_Load_Acquire(&Foreign_Enqueue_Pos);
+    }
+}
+
+
+static struct Reb_Foreign_Call *Try_Dequeue_Foreign_Call(void)
+{
+    uintptr_t pos = Foreign_Dequeue_Pos;
+    struct Reb_Foreign_Queue_Slot *slot
+        = &Foreign_Queue[pos & (FFI_FOREIGN_QUEUE_SIZE - 1)];
+
+    intptr_t diff = cast(intptr_t, Atomic_Load_Acquire(&slot->sequence))
+        - cast(intptr_t, pos + 1);
+
+    if (diff < 0)
+        return nullptr;  // empty (or a producer hasn't finished publishing)
+
+    struct Reb_Foreign_Call *call = slot->call;
+    Atomic_Store_Release(&slot->sequence, pos + FFI_FOREIGN_QUEUE_SIZE);
+    Foreign_Dequeue_Pos = pos + 1;
+    return call;
+}
+
+
+//
+//  Startup_Foreign_Callbacks: C
+//
+// The queue has to be set up before any closure that could post to it is
+// handed out, and this also decides which thread is the interpreter's.  It
+// is called when the first foreign callback is made, which is on the
+// interpreter thread by definition.
+//
+void Startup_Foreign_Callbacks(void)
+{
+    if (Foreign_Queue_Started)
+        return;
+
+    Note_Interpreter_Thread();
+
+    uintptr_t n;
+    for (n = 0; n < FFI_FOREIGN_QUEUE_SIZE; ++n) {
+        Foreign_Queue[n].sequence = n;
+        Foreign_Queue[n].call = nullptr;
+    }
+    Foreign_Enqueue_Pos = 0;
+    Foreign_Dequeue_Pos = 0;
+
+    Foreign_Queue_Started = true;
+}
+
+
+// What a foreign thread is allowed to know about the callback it is calling.
+// Everything here is plain C memory that stays put as long as the callback's
+// ACTION! is alive; the REBRIN itself is only dereferenced by the pump.
+//
+// Nothing keeps the ACTION! alive while calls to it wait in the queue, and a
+// void callback's caller doesn't wait--so it may be GC'd before the pump
+// gets to them.  The GC can't be told to keep the RIN while it is freeing
+// it, so instead the struct is kept until the calls `in_flight` are taken
+// out, and those calls are dropped (with a zeroed result, if the foreign
+// thread is waiting on one).
+//
+// !!! A foreign thread entering the callback just as it is GC'd could still
+// see it freed, like calling any callback that has been freed.  Keep the
+// ACTION! alive for as long as C might call it.
+//
+struct Reb_Foreign_Callback {
+    REBRIN *rin;  // nullptr once the ACTION! was GC'd with calls in flight
+    const struct Reb_Routine_Layout *layout;
+    REBLEN ret_offset;  // copied from the layout, which is freed with the RIN
+    REBLEN ret_size;  // bytes to copy back to the foreign caller, 0 if void
+    volatile uintptr_t in_flight;  // calls posted and not yet taken out
+};
+
+static void cleanup_foreign_callback(const REBVAL *v) {
+    struct Reb_Foreign_Callback *fc = VAL_HANDLE_POINTER(
+        struct Reb_Foreign_Callback, v
+    );
+    if (Atomic_Load_Acquire(&fc->in_flight) != 0) {
+        fc->rin = nullptr;  // Pump_Foreign_Callbacks() frees it when drained
+        fc->layout = nullptr;
+        return;
+    }
+    FREE(struct Reb_Foreign_Callback, fc);
+}
+
+
+//
+//  Init_Foreign_Callback: C
+//
+// Fill in IDX_ROUTINE_FOREIGN of a callback's RIN, giving back the pointer
+// that should be registered as the closure's user data.
+//
+void *Init_Foreign_Callback(REBRIN *r)
+{
+    assert(RIN_IS_CALLBACK(r) and not RIN_IS_VARIADIC(r));
+
+    struct Reb_Foreign_Callback *fc = TRY_ALLOC(struct Reb_Foreign_Callback);
+    if (fc == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Foreign_Callback)));
+
+    fc->rin = r;
+    fc->layout = RIN_LAYOUT(r);
+    fc->ret_offset = fc->layout->ret_offset;
+    fc->in_flight = 0;
+
+    if (IS_BLANK(RIN_RET_SCHEMA(r)))
+        fc->ret_size = 0;
+    else {
+        // libffi gives closures a return buffer of a full ffi_arg for
+        // integral results narrower than that, and the layout sized the
+        // return slot the same way.
+        //
+        ffi_type *rtype = RIN_CIF(r)->rtype;
+        fc->ret_size = rtype->size;
+        if (rtype->type != FFI_TYPE_STRUCT and fc->ret_size < sizeof(ffi_arg))
+            fc->ret_size = sizeof(ffi_arg);
+    }
+
+    Init_Handle_Cdata_Managed(
+        RIN_AT(r, IDX_ROUTINE_FOREIGN),
+        fc,
+        sizeof(struct Reb_Foreign_Callback),
+        &cleanup_foreign_callback
+    );
+    return fc;
+}
+
+
+//
+//  foreign_callback_dispatcher: C
+//
+// This is what libffi runs for a WRAP-CALLBACK/FOREIGN thunk, potentially on
+// any thread at all.  If it happens to be called on the interpreter thread
+// (e.g. the library invoked it synchronously) it just runs the callback, as
+// waiting on a pump that can't happen would deadlock.
+//
+void foreign_callback_dispatcher(
+    ffi_cif *cif,
+    void *ret,
+    void **args,
+    void *user_data
+){
+    struct Reb_Foreign_Callback *fc = cast(
+        struct Reb_Foreign_Callback*, user_data
+    );
+
+    if (On_Interpreter_Thread()) {
+        callback_dispatcher(cif, ret, args, fc->rin);
+        return;
+    }
+
+    const struct Reb_Routine_Layout *layout = fc->layout;
+    assert(layout->num_args == cif->nargs);
+
+    // Put the store after the argument pointers, aligned for any type.
+    //
+    REBLEN header_size = sizeof(struct Reb_Foreign_Call)
+        + (layout->num_args == 0 ? 0 : layout->num_args - 1) * sizeof(void*);
+    header_size = (header_size + FFI_FOREIGN_STORE_ALIGN - 1)
+        & ~cast(REBLEN, FFI_FOREIGN_STORE_ALIGN - 1);
+
+    struct Reb_Foreign_Call *call = cast(
+        struct Reb_Foreign_Call*, malloc(header_size + layout->store_size)
+    );
+    if (call == nullptr) {  // can't fail() or panic() off the main thread
+        fputs("FFI: Out of memory marshalling foreign callback\n", stderr);
+        abort();
+    }
+
+    call->callback = fc;
+    call->done = 0;
+    call->store = cast(REBYTE*, call) + header_size;
+
+    REBLEN i;
+    for (i = 0; i < layout->num_args; ++i) {
+        call->args[i] = call->store + layout->arg_offsets[i];
+        memcpy(call->args[i], args[i], cif->arg_types[i]->size);
+    }
+
+    Atomic_Fetch_Add(&fc->in_flight, 1);  // see cleanup_foreign_callback()
+
+    if (fc->ret_size == 0) {  // void, nothing to wait for...pump frees it
+        Enqueue_Foreign_Call(call);
+        return;
+    }
+
+    memset(call->store + layout->ret_offset, 0, fc->ret_size);
+    Enqueue_Foreign_Call(call);
+
+    while (Atomic_Load_Acquire(&call->done) == 0)
+        Ffi_Yield_Thread();
+
+    memcpy(ret, call->store + layout->ret_offset, fc->ret_size);
+    free(call);
+}
+
+
+//
+//  Pump_Foreign_Callbacks: C
+//
+// Run up to `limit` of the calls that foreign threads have queued, in the
+// order they were posted.  Returns how many were run.
+//
+// Only calls already posted when the pump starts are run, so that threads
+// posting as fast as the callbacks are serviced can't keep it from returning.
+//
+// !!! An error in the callback panics, just as it would for an ordinary
+// callback.  See MAKE-CALLBACK/FALLBACK.
+//
+REBLEN Pump_Foreign_Callbacks(REBLEN limit)
+{
+    if (not Foreign_Queue_Started)
+        return 0;
+
+    assert(On_Interpreter_Thread());
+
+    uintptr_t end = Atomic_Load_Acquire(&Foreign_Enqueue_Pos);
+
+    REBLEN count = 0;
+    while (count < limit and Foreign_Dequeue_Pos != end) {
+        struct Reb_Foreign_Call *call = Try_Dequeue_Foreign_Call();
+        if (call == nullptr)
+            break;
+
+        struct Reb_Foreign_Callback *fc = call->callback;
+        if (fc->rin != nullptr)
+            callback_dispatcher(
+                RIN_CIF(fc->rin),
+                call->store + fc->ret_offset,
+                call->args,
+                fc->rin
+            );
+        // else the ACTION! is gone, drop the call (its result stays zeroed)
+        ++count;
+
+        REBLEN ret_size = fc->ret_size;  // fc may be freed below
+
+        uintptr_t was = Atomic_Fetch_Add(&fc->in_flight, ~cast(uintptr_t, 0));
+        if (was == 1 and fc->rin == nullptr)
+            FREE(struct Reb_Foreign_Callback, fc);  // cleanup left it to us
+
+        if (ret_size == 0)
+            free(call);  // foreign thread didn't wait, so it's ours
+        else
+            Atomic_Store_Release(&call->done, 1);  // foreign thread frees
+    }
+
+    return count;
+}
+
+
+//=//// WORKER POOLS //////////////////////////////////////////////////////=//
+//
+// Jobs that run C code away from the interpreter go to worker threads,
+// started on first use.  A job is a struct embedding Reb_Ffi_Job as its
+// first member, whose `run` function only touches plain C memory--everything
+// involving REBVALs is done before it is submitted and after it is done, on
+// the interpreter thread.
+//
+// There are two pools.  CALL-MANY/PARALLEL slices are CPU-bound, so their
+// pool has one thread per core the machine has online.  CALL-ASYNC jobs may
+// block for as long as the C function likes (waiting on a socket, say), and
+// if they shared that pool they could keep the slices from running at all.
+// So they get a pool of their own, whose size doesn't depend on the cores.
+//
+// A single lock per pool guards its queue and the completion flags.  That's
+// cheap next to what a job does, as jobs are either blocking calls or whole
+// slices of rows.
+//
+
+#define FFI_POOL_MAX_WORKERS 64  // cap for machines with very many cores
+
+struct Reb_Ffi_Pool {
+  #if defined(TO_WINDOWS)
+    CRITICAL_SECTION lock;
+    CONDITION_VARIABLE work;  // signaled when a job is queued
+    CONDITION_VARIABLE done;  // broadcast when a job finishes
+    HANDLE threads[FFI_POOL_MAX_WORKERS];
+  #else
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    pthread_t threads[FFI_POOL_MAX_WORKERS];
+  #endif
+
+    REBLEN num_threads;  // 0 means the pool isn't running
+    bool stopping;
+    struct Reb_Ffi_Job *head;  // next job to run
+    struct Reb_Ffi_Job *tail;
+};
+
+static struct Reb_Ffi_Pool Pools[FFI_NUM_POOLS];
+
+#if defined(TO_WINDOWS)
+    #define Lock_Pool(p) EnterCriticalSection(&(p)->lock)
+    #define Unlock_Pool(p) LeaveCriticalSection(&(p)->lock)
+    #define Wait_Pool(p,cond) \
+        SleepConditionVariableCS(&(p)->cond, &(p)->lock, INFINITE)
+    #define Wait_Pool_Timed(p,cond,msec) \
+        SleepConditionVariableCS(&(p)->cond, &(p)->lock, (msec))
+    #define Signal_Pool(p,cond) WakeConditionVariable(&(p)->cond)
+    #define Broadcast_Pool(p,cond) WakeAllConditionVariable(&(p)->cond)
+#else
+    #define Lock_Pool(p) pthread_mutex_lock(&(p)->lock)
+    #define Unlock_Pool(p) pthread_mutex_unlock(&(p)->lock)
+    #define Wait_Pool(p,cond) pthread_cond_wait(&(p)->cond, &(p)->lock)
+    #define Wait_Pool_Timed(p,cond,msec) \
+        Wait_Pool_Until(&(p)->cond, &(p)->lock, (msec))
+    #define Signal_Pool(p,cond) pthread_cond_signal(&(p)->cond)
+    #define Broadcast_Pool(p,cond) pthread_cond_broadcast(&(p)->cond)
+
+    static void Wait_Pool_Until(
+        pthread_cond_t *cond,
+        pthread_mutex_t *lock,
+        long msec
+    ){
+        struct timespec ts;  // timed waits take an absolute CLOCK_REALTIME
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_sec += msec / 1000;
+        ts.tv_nsec += (msec % 1000) * 1000000;
+        if (ts.tv_nsec >= 1000000000) {
+            ++ts.tv_sec;
+            ts.tv_nsec -= 1000000000;
+        }
+        pthread_cond_timedwait(cond, lock, &ts);
+    }
+#endif
+
+
+static REBLEN Num_Online_Cpus(void)
+{
+  #if defined(TO_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    long n = info.dwNumberOfProcessors;
+  #else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+  #endif
+
+    if (n < 1)
+        return 1;  // sysconf() gives -1 if it can't tell
+    if (n > FFI_POOL_MAX_WORKERS)
+        return FFI_POOL_MAX_WORKERS;
+    return cast(REBLEN, n);
+}
+
+
+static void Run_Pool_Jobs(struct Reb_Ffi_Pool *pool)
+{
+    Lock_Pool(pool);
+    while (true) {
+        while (pool->head == nullptr and not pool->stopping)
+            Wait_Pool(pool, work);
+
+        if (pool->head == nullptr)
+            break;  // stopping, and nothing left to run
+
+        struct Reb_Ffi_Job *job = pool->head;
+        pool->head = job->next;
+        if (pool->head == nullptr)
+            pool->tail = nullptr;
+        Unlock_Pool(pool);
+
+        (*job->run)(job);
+
+        Lock_Pool(pool);
+        Atomic_Store_Release(&job->done, 1);
+        Broadcast_Pool(pool, done);
+    }
+    Unlock_Pool(pool);
+}
+
+#if defined(TO_WINDOWS)
+    static DWORD WINAPI Pool_Thread_Main(LPVOID pool) {
+        Run_Pool_Jobs(cast(struct Reb_Ffi_Pool*, pool));
+        return 0;
+    }
+#else
+    static void *Pool_Thread_Main(void *pool) {
+        Run_Pool_Jobs(cast(struct Reb_Ffi_Pool*, pool));
+        return nullptr;
+    }
+#endif
+
+
+static void Startup_Ffi_Pool(enum Reb_Ffi_Pool_Kind kind)
+{
+    struct Reb_Ffi_Pool *pool = &Pools[kind];
+
+  #if defined(TO_WINDOWS)
+    InitializeCriticalSection(&pool->lock);
+    InitializeConditionVariable(&pool->work);
+    InitializeConditionVariable(&pool->done);
+  #else
+    pthread_mutex_init(&pool->lock, nullptr);
+    pthread_cond_init(&pool->work, nullptr);
+    pthread_cond_init(&pool->done, nullptr);
+  #endif
+
+    pool->stopping = false;
+    pool->head = nullptr;
+    pool->tail = nullptr;
+
+    REBLEN want = (kind == FFI_POOL_COMPUTE)
+        ? Num_Online_Cpus()
+        : FFI_BLOCKING_WORKERS;
+
+    REBLEN n;
+    for (n = 0; n < want; ++n) {
+      #if defined(TO_WINDOWS)
+        pool->threads[n] = CreateThread(
+            nullptr, 0, &Pool_Thread_Main, pool, 0, nullptr
+        );
+        if (pool->threads[n] == nullptr)
+            break;
+      #else
+        if (0 != pthread_create(
+            &pool->threads[n], nullptr, &Pool_Thread_Main, pool
+        )){
+            break;
+        }
+      #endif
+    }
+
+    if (n == 0) {
+      #if defined(TO_WINDOWS)
+        DeleteCriticalSection(&pool->lock);
+      #else
+        pthread_cond_destroy(&pool->done);
+        pthread_cond_destroy(&pool->work);
+        pthread_mutex_destroy(&pool->lock);
+      #endif
+        fail ("FFI: Couldn't start any worker threads");
+    }
+
+    pool->num_threads = n;  // running with fewer is better than failing
+}
+
+
+//
+//  Num_Ffi_Workers: C
+//
+// How many threads the pool has, starting it if it isn't running yet (so a
+// caller can divide its work by the count it will actually get).
+//
+REBLEN Num_Ffi_Workers(enum Reb_Ffi_Pool_Kind kind)
+{
+    if (Pools[kind].num_threads == 0)
+        Startup_Ffi_Pool(kind);
+
+    return Pools[kind].num_threads;
+}
+
+
+//
+//  Submit_Ffi_Job: C
+//
+// Queue a job to be run by a thread of the given pool.  Must be called from
+// the interpreter thread.
+//
+void Submit_Ffi_Job(struct Reb_Ffi_Job *job, enum Reb_Ffi_Pool_Kind kind)
+{
+    struct Reb_Ffi_Pool *pool = &Pools[kind];
+    if (pool->num_threads == 0)
+        Startup_Ffi_Pool(kind);
+
+    job->done = 0;
+    job->next = nullptr;
+    job->pool = pool;
+
+    Lock_Pool(pool);
+    if (pool->tail)
+        pool->tail->next = job;
+    else
+        pool->head = job;
+    pool->tail = job;
+    Signal_Pool(pool, work);
+    Unlock_Pool(pool);
+}
+
+
+//
+//  Is_Ffi_Job_Done: C
+//
+bool Is_Ffi_Job_Done(struct Reb_Ffi_Job *job)
+{
+    return Atomic_Load_Acquire(&job->done) != 0;
+}
+
+
+//
+//  Wait_Ffi_Job: C
+//
+// Block until a submitted job has finished running.
+//
+void Wait_Ffi_Job(struct Reb_Ffi_Job *job)
+{
+    if (Is_Ffi_Job_Done(job))
+        return;
+
+    struct Reb_Ffi_Pool *pool = job->pool;
+    Lock_Pool(pool);
+    while (job->done == 0)
+        Wait_Pool(pool, done);
+    Unlock_Pool(pool);
+}
+
+
+//
+//  Wait_Ffi_Job_Pumping: C
+//
+// Like Wait_Ffi_Job(), but runs the foreign callbacks posted in the meantime.
+// The C code a job is running may be waiting on one of those, and only this
+// thread can service them, so just blocking could leave both waiting forever.
+//
+// Posting a callback doesn't wake anyone, so the wait is done in short slices
+// with a pump between them.  That means the callbacks can run any Rebol code,
+// so the caller mustn't be holding on to anything the GC could take away.
+//
+void Wait_Ffi_Job_Pumping(struct Reb_Ffi_Job *job)
+{
+    struct Reb_Ffi_Pool *pool = job->pool;
+
+    while (true) {
+        Pump_Foreign_Callbacks(FFI_FOREIGN_QUEUE_SIZE);
+
+        if (Is_Ffi_Job_Done(job))
+            return;
+
+        Lock_Pool(pool);
+        if (job->done == 0)
+            Wait_Pool_Timed(pool, done, FFI_JOB_PUMP_MSEC);
+        Unlock_Pool(pool);
+    }
+}
+
+
+static void Shutdown_Ffi_Pool(struct Reb_Ffi_Pool *pool)
+{
+    if (pool->num_threads == 0)
+        return;
+
+    Lock_Pool(pool);
+    pool->stopping = true;
+    Broadcast_Pool(pool, work);
+    Unlock_Pool(pool);
+
+    REBLEN n;
+    for (n = 0; n < pool->num_threads; ++n) {
+      #if defined(TO_WINDOWS)
+        WaitForSingleObject(pool->threads[n], INFINITE);
+        CloseHandle(pool->threads[n]);
+      #else
+        pthread_join(pool->threads[n], nullptr);
+      #endif
+    }
+
+  #if defined(TO_WINDOWS)
+    DeleteCriticalSection(&pool->lock);
+  #else
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->work);
+    pthread_mutex_destroy(&pool->lock);
+  #endif
+
+    pool->num_threads = 0;
+}
+
+
+//
+//  Shutdown_Ffi_Workers: C
+//
+// Jobs already queued are run before the workers exit, since the callers
+// are still holding on to them (and the C code they call may not like being
+// abandoned halfway).
+//
+void Shutdown_Ffi_Workers(void)
+{
+    Shutdown_Ffi_Pool(&Pools[FFI_POOL_COMPUTE]);
+    Shutdown_Ffi_Pool(&Pools[FFI_POOL_BLOCKING]);
+}
@@ -6,6 +6,10 @@ source: %ffi/mod-ffi.c
 depends: [
     %ffi/t-struct.c
     %ffi/t-routine.c
+    %ffi/c-thread.c
+    %ffi/c-mmap.c
+    %ffi/c-bulk.c
+    %ffi/c-image.c
 ]
 
 comment [
@@ -74,10 +78,16 @@ cflags: [
     ; padding, and MSVC warns about that.
     ;
     <msc:/wd4324>
+
+    ; Callbacks from foreign threads need to know which thread they're on.
+    ;
+    <gnu:-pthread>
 ]
 
 searches: []
 
-ldflags: []
+ldflags: [
+    <gnu:-pthread>
+]
 
 libraries: [%ffi]
@@ -28,6 +28,7 @@
 #include "tmp-mod-ffi.h"
 
 #include "reb-struct.h"
+#include "reb-thread.h"
 
 REBTYP *EG_Struct_Type = nullptr;  // (E)xtension (G)lobal
 
@@ -146,12 +147,29 @@ REBNATIVE(unregister_struct_hooks)
 {
     FFI_INCLUDE_PARAMS_OF_UNREGISTER_STRUCT_HOOKS;
 
+    Shutdown_Async_Calls();  // finishes C calls still running on workers
+    Shutdown_Struct_Interning();  // releases the schemas it kept alive
+    Shutdown_Pinned_Storage();
+    Shutdown_Callback_Contexts();  // frees the closures shared by callbacks
+    Shutdown_Closure_Pool();
+    Shutdown_Arg_Store();
     Unhook_Datatype(EG_Struct_Type);
 
     return Init_Void(D_OUT, SYM_VOID);
 }
 
 
+// The linker name is kept as a copy, so the caller changing their string
+// won't change what a lazy routine looks up (or what an image saves).
+//
+static void Init_Routine_Name(REBRIN *r, const REBVAL *name)
+{
+    REBVAL *copy = rebValue("copy", name);
+    Copy_Cell(RIN_AT(r, IDX_ROUTINE_NAME), copy);
+    rebRelease(copy);
+}
+
+
 //
 //  export make-routine: native [
 //
@@ -166,12 +184,17 @@ REBNATIVE(unregister_struct_hooks)
 //          [block!]
 //      /abi "Application Binary Interface ('CDECL, 'FASTCALL, etc.)"
 //          [word!]
+//      /lazy "Find the function and prepare the call on first use"
 //  ]
 //
 REBNATIVE(make_routine)
 //
 // !!! Would be nice if this could just take a filename and the lib management
 // was automatic, e.g. no LIBRARY! type.
+//
+// /LAZY is for bindings of whole libraries (see BIND-LIBRARY), where most of
+// the routines made are never called.  A missing function is then only an
+// error when the routine is used.
 {
     FFI_INCLUDE_PARAMS_OF_MAKE_ROUTINE;
 
@@ -181,6 +204,18 @@ REBNATIVE(make_routine)
     if (lib == nullptr)  // library was closed with CLOSE
         fail (PAR(lib));
 
+    if (REF(lazy)) {
+        REBACT *routine = Alloc_Ffi_Action_For_Spec(ARG(ffi_spec), abi, true);
+        REBRIN *r = ACT_DETAILS(routine);
+
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_CFUNC));  // see Bind_Lazy_Routine()
+        Init_Routine_Name(r, ARG(name));
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_CLOSURE));
+        Copy_Cell(RIN_AT(r, IDX_ROUTINE_ORIGIN), ARG(lib));
+
+        return Init_Action(D_OUT, routine, ANONYMOUS, UNBOUND);
+    }
+
     // Find_Function takes a char* on both Windows and Posix.
     //
     // !!! Should it error if any bytes aren't ASCII?
@@ -193,10 +228,11 @@ REBNATIVE(make_routine)
 
     // Process the parameter types into a function, then fill it in
 
-    REBACT *routine = Alloc_Ffi_Action_For_Spec(ARG(ffi_spec), abi);
+    REBACT *routine = Alloc_Ffi_Action_For_Spec(ARG(ffi_spec), abi, false);
     REBRIN *r = ACT_DETAILS(routine);
 
     Init_Handle_Cfunc(RIN_AT(r, IDX_ROUTINE_CFUNC), cfunc);
+    Init_Routine_Name(r, ARG(name));
     Init_Blank(RIN_AT(r, IDX_ROUTINE_CLOSURE));
     Copy_Cell(RIN_AT(r, IDX_ROUTINE_ORIGIN), ARG(lib));
 
@@ -234,7 +270,7 @@ REBNATIVE(make_routine_raw)
     if (cfunc == nullptr)
         fail ("FFI: nullptr pointer not allowed for raw MAKE-ROUTINE");
 
-    REBACT *routine = Alloc_Ffi_Action_For_Spec(ARG(ffi_spec), abi);
+    REBACT *routine = Alloc_Ffi_Action_For_Spec(ARG(ffi_spec), abi, false);
     REBRIN *r = ACT_DETAILS(routine);
 
     Init_Handle_Cfunc(RIN_AT(r, IDX_ROUTINE_CFUNC), cfunc);
@@ -245,6 +281,73 @@ REBNATIVE(make_routine_raw)
 }
 
 
+//
+//  export encode-ffi-image: native [
+//
+//  {Save routines and structs to a binary image (see SAVE-FFI-IMAGE)}
+//
+//      return: [binary!]
+//      entries "Alternating WORD! names and MAKE-ROUTINE actions or STRUCT!s"
+//          [block!]
+//  ]
+//
+REBNATIVE(encode_ffi_image)
+{
+    FFI_INCLUDE_PARAMS_OF_ENCODE_FFI_IMAGE;
+
+    return Encode_Ffi_Image(D_OUT, ARG(entries));
+}
+
+
+//
+//  export decode-ffi-image: native [
+//
+//  {Load routines and structs from a binary image (see LOAD-FFI-IMAGE)}
+//
+//      return: "Alternating WORD! names and routines or STRUCT!s"
+//          [block!]
+//      image "Made by ENCODE-FFI-IMAGE on the same platform"
+//          [binary!]
+//      lib "Library DLL that the routines' C functions live in"
+//          [library!]
+//  ]
+//
+REBNATIVE(decode_ffi_image)
+//
+// The routines are made as if by MAKE-ROUTINE/LAZY, so nothing is looked up
+// in the library until they're called.
+{
+    FFI_INCLUDE_PARAMS_OF_DECODE_FFI_IMAGE;
+
+    if (VAL_LIBRARY(ARG(lib)) == nullptr)  // library was closed with CLOSE
+        fail (PAR(lib));
+
+    return Decode_Ffi_Image(D_OUT, ARG(image), ARG(lib));
+}
+
+
+// The argument of a callback's spec named by WRAP-CALLBACK/CONTEXT, as an
+// index among the arguments (which are the spec's WORD!s, in order).
+//
+static REBLEN Context_Arg_Index(const REBVAL *ffi_spec, const REBVAL *name)
+{
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, ffi_spec);
+
+    REBLEN index = 0;
+    for (; item != tail; ++item) {
+        if (not IS_WORD(item))
+            continue;
+
+        if (Are_Synonyms(VAL_WORD_SYMBOL(item), VAL_WORD_SYMBOL(name)))
+            return index;
+        ++index;
+    }
+
+    fail ("FFI: WRAP-CALLBACK/CONTEXT names an argument not in the spec");
+}
+
+
 //
 //  export wrap-callback: native [
 //
@@ -257,30 +360,91 @@ REBNATIVE(make_routine_raw)
 //          [block!]
 //      /abi "Application Binary Interface ('CDECL, 'FASTCALL, etc.)"
 //          [word!]
+//      /foreign "May be called from other threads (see PUMP-CALLBACKS)"
+//      /context "The `void*` argument C passes through (see CALLBACK-CONTEXT)"
+//          [word!]
 //  ]
 //
 REBNATIVE(wrap_callback)
+//
+// With /CONTEXT, the callback doesn't get a closure of its own.  Its C
+// function pointer is shared by all callbacks with the same signature, and
+// which one to run is looked up from the context pointer C passes back.
 {
     FFI_INCLUDE_PARAMS_OF_WRAP_CALLBACK;
 
     ffi_abi abi = Abi_From_Word(REF(abi));;
 
-    REBACT *callback = Alloc_Ffi_Action_For_Spec(ARG(ffi_spec), abi);
+    if (REF(context) and REF(foreign))
+        fail ("FFI: WRAP-CALLBACK can't be both /CONTEXT and /FOREIGN");
+
+    REBACT *callback = Alloc_Ffi_Action_For_Spec(
+        ARG(ffi_spec),
+        abi,
+        did REF(context)  // lazy, so there's no CIF made just to be dropped
+    );
     REBRIN *r = ACT_DETAILS(callback);
 
-    void *thunk;  // actually CFUNC (FFI uses void*, may not be same size!)
-    ffi_closure *closure = cast(ffi_closure*, ffi_closure_alloc(
-        sizeof(ffi_closure), &thunk
-    ));
+    if (RIN_HAS_CONVERSIONS(r))  // C code provides the pointers for these
+        fail ("FFI: Callbacks can't have out or text parameters");
+
+    Copy_Cell(RIN_AT(r, IDX_ROUTINE_ORIGIN), ARG(action));
 
-    if (closure == nullptr)
-        fail ("FFI: Couldn't allocate closure");
+    if (REF(context)) {
+        if (RIN_IS_VARIADIC(r))
+            fail ("FFI: WRAP-CALLBACK/CONTEXT can't be variadic");
+
+        Init_Context_Callback(
+            r,
+            Context_Arg_Index(ARG(ffi_spec), ARG(context))
+        );
+        return Init_Action(D_OUT, callback, ANONYMOUS, UNBOUND);
+    }
+
+    // A foreign thread's callback is run later by the interpreter, using a
+    // copy of the C argument bytes.  A REBVAL* can't be used by any thread
+    // but the interpreter's, so it would be garbage by then.
+    //
+    void *user_data = r;
+    if (REF(foreign)) {
+        if (
+            IS_WORD(RIN_RET_SCHEMA(r))
+            and VAL_WORD_ID(RIN_RET_SCHEMA(r)) == SYM_REBVAL
+        ){
+            fail ("FFI: Foreign thread callbacks can't return REBVAL");
+        }
+
+        REBLEN n;
+        for (n = 0; n < RIN_NUM_FIXED_ARGS(r); ++n) {
+            REBVAL *schema = RIN_ARG_SCHEMA(r, n);
+            if (IS_WORD(schema) and VAL_WORD_ID(schema) == SYM_REBVAL)
+                fail ("FFI: Foreign thread callbacks can't take REBVAL");
+        }
+
+        Startup_Foreign_Callbacks();
+        user_data = Init_Foreign_Callback(r);
+    }
+
+    // The slot goes in the RIN right away, so it gets back to the pool when
+    // the callback is GC'd even if prepping it fails.
+    //
+    struct Reb_Closure_Slot *slot = Claim_Closure_Slot();
+    Init_Handle_Cdata_Managed(
+        RIN_AT(r, IDX_ROUTINE_CLOSURE),
+        slot,
+        sizeof(struct Reb_Closure_Slot),
+        &cleanup_ffi_closure
+    );
+
+    void *thunk = slot->thunk;  // actually CFUNC (FFI says void*, see below)
 
     ffi_status status = ffi_prep_closure_loc(
-        closure,
+        slot->closure,
         RIN_CIF(r),
-        callback_dispatcher,  // when thunk is called, calls this function...
-        r,  // ...and this piece of data is passed to callback_dispatcher
+        REF(foreign)  // when thunk is called, calls this function...
+            ? &foreign_callback_dispatcher
+            : &callback_dispatcher,
+        user_data,  // ...and this piece of data is passed to the dispatcher
         thunk
     );
 
@@ -299,18 +463,172 @@ REBNATIVE(wrap_callback)
     memcpy(&cfunc_thunk, &thunk, sizeof(cfunc_thunk));
 
     Init_Handle_Cfunc(RIN_AT(r, IDX_ROUTINE_CFUNC), cfunc_thunk);
-    Init_Handle_Cdata_Managed(
-        RIN_AT(r, IDX_ROUTINE_CLOSURE),
-        closure,
-        sizeof(&closure),
-        &cleanup_ffi_closure
-    );
-    Copy_Cell(RIN_AT(r, IDX_ROUTINE_ORIGIN), ARG(action));
 
     return Init_Action(D_OUT, callback, ANONYMOUS, UNBOUND);
 }
 
 
+//
+//  export callback-context: native [
+//
+//  {Get the context pointer C has to pass to a WRAP-CALLBACK/CONTEXT callback}
+//
+//      return: "The `void*` to give C along with ADDR-OF the callback"
+//          [integer!]
+//      callback [action!]
+//  ]
+//
+REBNATIVE(callback_context)
+{
+    FFI_INCLUDE_PARAMS_OF_CALLBACK_CONTEXT;
+
+    if (not IS_ACTION_RIN(ARG(callback)))
+        fail ("FFI: Not a callback made with WRAP-CALLBACK/CONTEXT");
+
+    REBRIN *r = ACT_DETAILS(VAL_ACTION(ARG(callback)));
+    const REBVAL *context = RIN_AT(r, IDX_ROUTINE_CONTEXT);
+    if (not IS_HANDLE(context))
+        fail ("FFI: Not a callback made with WRAP-CALLBACK/CONTEXT");
+
+    return Init_Integer(
+        D_OUT,
+        cast(intptr_t, VAL_HANDLE_POINTER(REBYTE, context))
+    );
+}
+
+
+//
+//  export pump-callbacks: native [
+//
+//  {Run WRAP-CALLBACK/FOREIGN callbacks that other threads have queued up}
+//
+//      return: "How many callbacks were run"
+//          [integer!]
+//      /limit "Most callbacks to run (default is to drain what's queued)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(pump_callbacks)
+//
+// Callbacks are run in the order they were queued, on the interpreter
+// thread.  A foreign thread calling a non-void callback is blocked until
+// this runs it, so an event loop wanting a prompt answer should pump often.
+{
+    FFI_INCLUDE_PARAMS_OF_PUMP_CALLBACKS;
+
+    REBLEN limit = UINT32_MAX;
+    if (REF(limit)) {
+        if (VAL_INT64(REF(limit)) < 0)
+            fail (Error_Out_Of_Range(REF(limit)));
+        limit = VAL_UINT32(REF(limit));
+    }
+
+    return Init_Integer(D_OUT, Pump_Foreign_Callbacks(limit));
+}
+
+
+//
+//  export callback-pool-stats: native [
+//
+//  {Report on the pool of closures that WRAP-CALLBACK reuses}
+//
+//      return: "Object with LIVE, IDLE, CREATED, and REUSED counts"
+//          [object!]
+//  ]
+//
+REBNATIVE(callback_pool_stats)
+//
+// LIVE and IDLE together are the closures currently allocated, so that's the
+// executable memory footprint.  IDLE is capped at a fixed number.
+{
+    FFI_INCLUDE_PARAMS_OF_CALLBACK_POOL_STATS;
+
+    return rebValue("make object! [",
+        "live:", rebI(Closure_Pool.num_live),
+        "idle:", rebI(Closure_Pool.num_free),
+        "created:", rebI(Closure_Pool.created),
+        "reused:", rebI(Closure_Pool.reused),
+    "]");
+}
+
+
+//
+//  export profile-ffi: native [
+//
+//  {Turn the counters reported by FFI-STATS on or off}
+//
+//      return: "Whether the counters were on before"
+//          [logic!]
+//      on [logic!]
+//  ]
+//
+REBNATIVE(profile_ffi)
+//
+// The counters are off by default, so that calls don't keep reading a clock.
+{
+    FFI_INCLUDE_PARAMS_OF_PROFILE_FFI;
+
+  #if defined(FFI_NO_STATS)
+    fail ("FFI: This build was made with FFI_NO_STATS");
+  #else
+    bool was_on = Ffi_Stats_On;
+    Ffi_Stats_On = VAL_LOGIC(ARG(on));
+    return Init_Logic(D_OUT, was_on);
+  #endif
+}
+
+
+//
+//  export ffi-stats: native [
+//
+//  {Get the profiling counters of a routine or callback}
+//
+//      return: "Object with CALLS, times in nanoseconds, and other counts"
+//          [object!]
+//      routine [action!]
+//      /reset "Zero the counters after reading them"
+//  ]
+//
+REBNATIVE(ffi_stats)
+//
+// Times are sums over all calls made while PROFILE-FFI was on.  MARSHAL-NS
+// is spent converting arguments (for a callback, the C arguments into Rebol
+// values), CALL-NS is spent in the C function (for a callback, in the Rebol
+// action), and CONVERT-NS is spent converting the result.
+{
+    FFI_INCLUDE_PARAMS_OF_FFI_STATS;
+
+    if (not IS_ACTION_RIN(ARG(routine)))
+        fail ("FFI-STATS only works on ACTION!s created by FFI");
+
+  #if defined(FFI_NO_STATS)
+    fail ("FFI: This build was made with FFI_NO_STATS");
+  #else
+    struct Reb_Ffi_Stats *stats = RIN_STATS(
+        ACT_DETAILS(VAL_ACTION(ARG(routine)))
+    );
+
+    REBVAL *result = rebValue("make object! [",
+        "calls:", rebI(stats->calls),
+        "marshal-ns:", rebI(stats->marshal_ns),
+        "call-ns:", rebI(stats->call_ns),
+        "convert-ns:", rebI(stats->convert_ns),
+        "store-bytes:", rebI(stats->store_bytes),
+        "cif-preps:", rebI(stats->cif_preps),
+        "reentries:", rebI(stats->reentries),
+    "]");
+
+    if (REF(reset)) {
+        REBI64 depth = stats->depth;  // tracks running calls, so it stays
+        memset(stats, 0, sizeof(struct Reb_Ffi_Stats));
+        stats->depth = depth;
+    }
+
+    return result;
+  #endif
+}
+
+
 //
 //  export addr-of: native [
 //
@@ -335,6 +653,8 @@ REBNATIVE(addr_of) {
         // just the wrapped DLL function if it's an ordinary routine
         //
         REBRIN *rin = ACT_DETAILS(VAL_ACTION(v));
+        if (not RIN_IS_CALLBACK(rin))
+            Ensure_Routine_Bound(rin);
         return Init_Integer(
             D_OUT, cast(intptr_t, RIN_CFUNC(rin))
         );
@@ -352,10 +672,186 @@ REBNATIVE(addr_of) {
     // "do not move in memory" bit would be needed for the BINARY! or a
     // HANDLE! to a non-moving malloc would need to be used instead.
     //
+    // (A struct made with `[pinned: N]` is the latter, so its address is
+    // guaranteed for as long as the struct is alive.)
+    //
+    // C code could write through the address, now or whenever later, so a
+    // struct that is sharing its data with copies (or is such a copy) stops
+    // sharing now, and its data isn't shared again.
+    //
+    Prepare_Struct_For_Address(VAL_STRUCT(v));
     return Init_Integer(D_OUT, cast(intptr_t, VAL_STRUCT_DATA_AT(v)));
 }
 
 
+//
+//  export call-many: native [
+//
+//  {Call a routine once per row of columnar data, collecting the results}
+//
+//      return: "Result of each call, or NULL if the routine returns void"
+//          [<opt> vector!]
+//      routine "Non-variadic routine created with MAKE-ROUTINE"
+//          [action!]
+//      columns {Reduced; VECTOR!/BINARY! of each argument's C type, or scalar
+//          (a column for a pointer must be a VECTOR! of addresses)}
+//          [block!]
+//      /into "VECTOR! matching the return type to write the results into"
+//          [vector!]
+//      /parallel "Split the rows across worker threads (needs <reentrant>)"
+//  ]
+//
+REBNATIVE(call_many)
+//
+// This exists for running C kernels over large arrays: calling the routine
+// normally would pay for a frame, a full argument conversion, and a boxed
+// result on every element.  A column is taken as packed C data--so a BINARY!
+// given for an `[int32]` argument holds 4 bytes per row.  Anything else (for
+// instance an INTEGER!) is converted once and passed on every row.
+//
+// For a `[pointer]` argument, only a VECTOR! of integers the width of a
+// pointer is a column (of addresses).  A BINARY! or TEXT! is passed as the
+// address of its data on every row, as it would be to an ordinary call.
+//
+// /PARALLEL is for CPU-bound kernels that are safe to run on many threads at
+// once, which the routine's spec has to promise with a <reentrant> tag.  It
+// must not call back into Rebol (except via WRAP-CALLBACK/FOREIGN).
+{
+    FFI_INCLUDE_PARAMS_OF_CALL_MANY;
+
+    if (not IS_ACTION_RIN(ARG(routine)))
+        fail ("CALL-MANY only works on ACTION!s created by FFI");
+
+    REBVAL *columns = rebValue("reduce", ARG(columns));
+
+    Call_Routine_Many(
+        D_OUT,
+        ARG(routine),
+        columns,
+        REF(into),
+        did REF(parallel)
+    );
+
+    rebRelease(columns);
+    return D_OUT;
+}
+
+
+//
+//  export call-async: native [
+//
+//  {Start a routine call on a worker thread, so blocking doesn't stall Rebol}
+//
+//      return: "Job to give to ASYNC-WAIT (or poll with ASYNC-READY?)"
+//          [handle!]
+//      routine "Non-variadic routine created with MAKE-ROUTINE"
+//          [action!]
+//      arguments "Reduced; one value for each of the routine's arguments"
+//          [block!]
+//  ]
+//
+REBNATIVE(call_async)
+//
+// The arguments are converted right away, so errors in them are raised here
+// rather than by ASYNC-WAIT.  A TEXT! or BINARY! passed by pointer can't be
+// modified until the result is collected.
+{
+    FFI_INCLUDE_PARAMS_OF_CALL_ASYNC;
+
+    if (not IS_ACTION_RIN(ARG(routine)))
+        fail ("CALL-ASYNC only works on ACTION!s created by FFI");
+
+    REBVAL *arguments = rebValue("reduce", ARG(arguments));
+    Call_Routine_Async(D_OUT, ARG(routine), arguments);
+    rebRelease(arguments);
+
+    return D_OUT;
+}
+
+
+//
+//  export async-ready?: native [
+//
+//  {Check if a CALL-ASYNC job has finished, without waiting}
+//
+//      return: [logic!]
+//      job [handle!]
+//  ]
+//
+REBNATIVE(async_ready_q)
+{
+    FFI_INCLUDE_PARAMS_OF_ASYNC_READY_Q;
+
+    return Init_Logic(D_OUT, Is_Async_Call_Done(ARG(job)));
+}
+
+
+//
+//  export async-wait: native [
+//
+//  {Wait for a CALL-ASYNC job to finish, and get the routine's result}
+//
+//      return: "Result of the routine, or NULL if it returns void"
+//          [<opt> any-value!]
+//      job [handle!]
+//  ]
+//
+REBNATIVE(async_wait)
+{
+    FFI_INCLUDE_PARAMS_OF_ASYNC_WAIT;
+
+    return Finish_Async_Call(D_OUT, ARG(job));
+}
+
+
+//
+//  export routine-cache-stats: native [
+//
+//  {Report how well a variadic routine's per-signature CIF cache is working}
+//
+//      return: "Object with HITS, MISSES, and ENTRIES (signatures cached)"
+//          [object!]
+//      routine "Variadic routine created with MAKE-ROUTINE"
+//          [action!]
+//      /reset "Zero the hit and miss counters (cached CIFs are kept)"
+//  ]
+//
+REBNATIVE(routine_cache_stats)
+{
+    FFI_INCLUDE_PARAMS_OF_ROUTINE_CACHE_STATS;
+
+    REBVAL *v = ARG(routine);
+    if (not IS_ACTION_RIN(v))
+        fail ("ROUTINE-CACHE-STATS only works on ACTION!s created by FFI");
+
+    REBRIN *rin = ACT_DETAILS(VAL_ACTION(v));
+    if (not RIN_IS_VARIADIC(rin))
+        fail ("ROUTINE-CACHE-STATS only works on variadic routines");
+
+    struct Reb_Cif_Cache *cache = RIN_CIF_CACHE(rin);
+
+    REBLEN entries = 0;
+    REBLEN n;
+    for (n = 0; n < FFI_CIF_CACHE_SIZE; ++n) {
+        if (cache->entries[n].args_fftypes)
+            ++entries;
+    }
+
+    REBVAL *stats = rebValue("make object! [",
+        "hits:", rebI(cache->hits),
+        "misses:", rebI(cache->misses),
+        "entries:", rebI(entries),
+    "]");
+
+    if (REF(reset)) {
+        cache->hits = 0;
+        cache->misses = 0;
+    }
+
+    return stats;
+}
+
+
 //
 //  export make-similar-struct: native [
 //
@@ -380,12 +876,178 @@ REBNATIVE(make_similar_struct)
     REBVAL *spec = ARG(spec);
     REBVAL *body = ARG(body);
 
-    Init_Struct(D_OUT, Copy_Struct_Managed(VAL_STRUCT(spec)));
-    Init_Struct_Fields(D_OUT, body);
+    // The copy shares the data of the spec struct until one of them is
+    // written, which may be right away if the body sets any fields.
+    //
+    Init_Struct(D_OUT, Copy_Struct_Managed(VAL_STRUCT(spec), true));
+    if (not IS_BLANK(body))
+        Init_Struct_Fields(D_OUT, body);
     return D_OUT;
 }
 
 
+//
+//  export make-struct-array: native [
+//
+//  {Create a contiguous C array of structs, e.g. `struct point pts[N]`}
+//
+//      return: "Struct array, indexed like `pts/1/x` to get element views"
+//          [struct!]
+//      element "Struct whose layout (and initial data) each element gets"
+//          [struct!]
+//      count "Number of elements"
+//          [integer!]
+//      /at "Map onto existing memory at this address instead of allocating"
+//          [integer!]
+//      /stride "Bytes from one element to the next (default is the size)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(make_struct_array)
+{
+    FFI_INCLUDE_PARAMS_OF_MAKE_STRUCT_ARRAY;
+
+    if (VAL_INT64(ARG(count)) < 0)
+        fail (PAR(count));
+
+    uintptr_t raw_addr = 0;
+    if (REF(at)) {
+        raw_addr = cast(uintptr_t, VAL_INT64(ARG(at)));
+        if (raw_addr == 0)
+            fail ("FFI: nullptr pointer not allowed for MAKE-STRUCT-ARRAY/AT");
+    }
+
+    REBLEN stride = 0;  // packed
+    if (REF(stride)) {
+        if (VAL_INT64(ARG(stride)) <= 0)
+            fail (PAR(stride));
+        stride = VAL_UINT32(ARG(stride));
+    }
+
+    return Init_Struct_Array(
+        D_OUT,
+        VAL_STRUCT(ARG(element)),
+        VAL_UINT32(ARG(count)),
+        stride,
+        raw_addr
+    );
+}
+
+
+//
+//  export map-struct-file: native [
+//
+//  {Use a memory-mapped file as the storage of a struct, or a struct array}
+//
+//      return: "Struct (or with /COUNT a struct array) using the file's bytes"
+//          [struct!]
+//      element "Struct whose layout the file's records have"
+//          [struct!]
+//      path "File to map, which must already exist"
+//          [file!]
+//      /offset "Byte position in the file to start at (default is 0)"
+//          [integer!]
+//      /count "Map an array of this many (0 for all whole records in file)"
+//          [integer!]
+//      /write {Changes go to the file (default is private copy-on-write:
+//          writes are allowed, but only change this process's copy)}
+//      /advise "Access hint: NORMAL, SEQUENTIAL, RANDOM, WILLNEED, DONTNEED"
+//          [word!]
+//  ]
+//
+REBNATIVE(map_struct_file)
+//
+// The file stays mapped until the struct (and anything viewing it) is GC'd,
+// or UNMAP-STRUCT is used.  Records are read from disk as they are touched,
+// so it's fine to map files far bigger than memory.
+{
+    FFI_INCLUDE_PARAMS_OF_MAP_STRUCT_FILE;
+
+    return Map_Struct_File(
+        D_OUT,
+        VAL_STRUCT(ARG(element)),
+        ARG(path),
+        REF(offset) ? VAL_INT64(REF(offset)) : 0,
+        REF(count),
+        did REF(write),
+        REF(advise)
+    );
+}
+
+
+//
+//  export flush-struct-map: native [
+//
+//  {Write changes to a MAP-STRUCT-FILE/WRITE struct through to the file}
+//
+//      return: [<opt>]
+//      struct [struct!]
+//  ]
+//
+REBNATIVE(flush_struct_map)
+{
+    FFI_INCLUDE_PARAMS_OF_FLUSH_STRUCT_MAP;
+
+    Flush_Struct_Map(ARG(struct));
+    return nullptr;
+}
+
+
+//
+//  export unmap-struct: native [
+//
+//  {Unmap the file of a MAP-STRUCT-FILE struct now instead of at GC time}
+//
+//      return: [<opt>]
+//      struct "Becomes inaccessible (as do any views of it)"
+//          [struct!]
+//  ]
+//
+REBNATIVE(unmap_struct)
+{
+    FFI_INCLUDE_PARAMS_OF_UNMAP_STRUCT;
+
+    Unmap_Struct(ARG(struct));
+    return nullptr;
+}
+
+
+//
+//  export move-struct-view: native [
+//
+//  {Aim an element view of a struct array at another element, in place}
+//
+//      return: "The same view, now aliasing the requested element"
+//          [struct!]
+//      view "A view picked out of the array (changes all references to it)"
+//          [struct!]
+//      array "The struct array the view was picked from"
+//          [struct!]
+//      index "1-based position in the array"
+//          [integer!]
+//  ]
+//
+REBNATIVE(move_struct_view)
+//
+// Picking `array/:i` makes a new view each time, which is a small but real
+// allocation.  Loops over large arrays can instead pick one view and move it.
+{
+    FFI_INCLUDE_PARAMS_OF_MOVE_STRUCT_VIEW;
+
+    REBSTU *array = VAL_STRUCT(ARG(array));
+    if (not STU_IS_ARRAY(array))
+        fail (PAR(array));
+
+    REBI64 index = VAL_INT64(ARG(index));
+    if (index < 1)
+        fail (Error_Out_Of_Range(ARG(index)));
+
+    Move_Struct_View(VAL_STRUCT(ARG(view)), array, cast(REBLEN, index - 1));
+
+    RETURN (ARG(view));
+}
+
+
 //
 //  destroy-struct-storage: native [
 //
@@ -540,3 +1202,173 @@ REBNATIVE(set_at_pointer)
 
     RETURN (ARG(value));  // Returning cell would rebRelease()
 }
+
+
+// Raw addresses are INTEGER!s, as with ADDR-OF and pointer fields, with an
+// optional byte offset.  Reading through address zero is always a mistake.
+//
+static REBYTE *Pointer_From_Args(
+    const REBVAL *address,
+    const REBVAL *opt_offset
+){
+    intptr_t ipt = cast(intptr_t, VAL_INT64(address));
+    if (ipt == 0)
+        fail (Error_Bad_Memory_Raw(address, nullptr));
+
+    REBYTE *p = cast(REBYTE*, ipt);
+    if (opt_offset)
+        p += VAL_INT64(opt_offset);
+    return p;
+}
+
+
+// The bytes of a BINARY! or VECTOR! that a bulk transfer covers, which is
+// all of them unless /PART asks for fewer elements.
+//
+static const REBYTE *Bulk_Bytes_For_Value(
+    REBLEN *size_out,
+    const REBVAL *v,
+    const REBVAL *opt_part
+){
+    REBLEN len;
+    REBLEN wide;
+    const REBYTE *head;
+    if (IS_BINARY(v)) {
+        REBSIZ size;
+        head = VAL_BYTES_AT(&size, v);
+        len = size;
+        wide = 1;
+    }
+    else {
+        assert(IS_VECTOR(v));
+        wide = VAL_VECTOR_WIDE(v);
+        head = cast(const REBYTE*, VAL_VECTOR_HEAD(v))
+            + VAL_VECTOR_INDEX(v) * wide;  // what VAL_VECTOR_LEN_AT() counts
+        len = VAL_VECTOR_LEN_AT(v);
+    }
+
+    if (opt_part) {
+        REBI64 part = VAL_INT64(opt_part);
+        if (part < 0 or part > cast(REBI64, len))
+            fail (Error_Out_Of_Range(opt_part));
+        len = VAL_INT32(opt_part);
+    }
+
+    *size_out = len * wide;
+    return head;
+}
+
+
+//
+//  export peek-at-pointer: native [
+//
+//  {Read a C scalar of the given type from memory, without a STRUCT!}
+//
+//      return: [integer! decimal!]
+//      address [integer!]
+//      type "FFI scalar type, e.g. INT32 or DOUBLE"
+//          [word!]
+//      /offset "Bytes to add to the address"
+//          [integer!]
+//  ]
+//
+REBNATIVE(peek_at_pointer)
+{
+    FFI_INCLUDE_PARAMS_OF_PEEK_AT_POINTER;
+
+    REBYTE *p = Pointer_From_Args(ARG(address), REF(offset));
+    return Peek_Scalar_At(D_OUT, p, VAL_WORD_ID(ARG(type)));
+}
+
+
+//
+//  export poke-at-pointer: native [
+//
+//  {Write a value to memory as a C scalar of the given type}
+//
+//      return: "The value written"
+//          [integer! decimal!]
+//      address [integer!]
+//      type "FFI scalar type, e.g. INT32 or DOUBLE"
+//          [word!]
+//      value [integer! decimal!]
+//      /offset "Bytes to add to the address"
+//          [integer!]
+//  ]
+//
+REBNATIVE(poke_at_pointer)
+{
+    FFI_INCLUDE_PARAMS_OF_POKE_AT_POINTER;
+
+    REBYTE *p = Pointer_From_Args(ARG(address), REF(offset));
+    Poke_Scalar_At(p, VAL_WORD_ID(ARG(type)), ARG(value));
+
+    RETURN (ARG(value));
+}
+
+
+//
+//  export read-at-pointer: native [
+//
+//  {Copy elements from memory into an existing BINARY! or VECTOR!}
+//
+//      return: [binary! vector!]
+//      dest "Filled from its current position, elements as they are in C"
+//          [binary! vector!]
+//      source "Address to copy from"
+//          [integer!]
+//      /part "Number of elements to copy (default is the length of dest)"
+//          [integer!]
+//      /offset "Bytes to add to the source address"
+//          [integer!]
+//  ]
+//
+REBNATIVE(read_at_pointer)
+//
+// This is a memcpy(), so the caller picks the VECTOR! whose element type
+// matches the C array.  The point is to move bulk data in and out of C
+// buffers with no STRUCT! or per-element cell in between.
+{
+    FFI_INCLUDE_PARAMS_OF_READ_AT_POINTER;
+
+    REBLEN size;
+    REBYTE *dest = m_cast(REBYTE*, Bulk_Bytes_For_Value(
+        &size, ENSURE_MUTABLE(ARG(dest)), REF(part)
+    ));
+    const REBYTE *src = Pointer_From_Args(ARG(source), REF(offset));
+
+    memcpy(dest, src, size);
+
+    RETURN (ARG(dest));
+}
+
+
+//
+//  export write-at-pointer: native [
+//
+//  {Copy the elements of a BINARY! or VECTOR! to memory}
+//
+//      return: "Address just past the last byte written"
+//          [integer!]
+//      target "Address to copy to"
+//          [integer!]
+//      source "Copied from its current position, elements as they are in C"
+//          [binary! vector!]
+//      /part "Number of elements to copy (default is the length of source)"
+//          [integer!]
+//      /offset "Bytes to add to the target address"
+//          [integer!]
+//  ]
+//
+REBNATIVE(write_at_pointer)
+{
+    FFI_INCLUDE_PARAMS_OF_WRITE_AT_POINTER;
+
+    REBLEN size;
+    const REBYTE *src = Bulk_Bytes_For_Value(&size, ARG(source), REF(part));
+    REBYTE *dest = Pointer_From_Args(ARG(target), REF(offset));
+
+    memcpy(dest, src, size);
+
+    return Init_Integer(D_OUT, cast(intptr_t, dest + size));
+}
@@ -168,6 +168,14 @@ enum {
     //
     IDX_FIELD_WIDE = 5,
 
+    // HANDLE! to a hash table mapping field names to positions in the
+    // fieldlist if this is a struct, or BLANK! if it is not.  The table also
+    // carries a Reb_Field_Access for each field.  Like the FFTYPE, a field
+    // of struct type borrows the handle from the schema of the struct it
+    // was made from...so all instances share one index.
+    //
+    IDX_FIELD_INDEX = 6,
+
     IDX_FIELD_MAX
 };
 
@@ -232,6 +240,39 @@ inline static REBLEN FLD_LEN_BYTES_TOTAL(REBFLD *f) {
     return FLD_WIDE(f);
 }
 
+
+// The accessors above each read a boxed cell out of the REBFLD array, which
+// adds up when they're used on every read or write of struct data.  So when
+// a schema is interned, each of its fields is "compiled" into one of these,
+// with the C type reduced to a small integer that a switch() can jump on.
+//
+// (The integral kinds come first and then the floating point ones, so that
+// `kind <= FLD_KIND_INT64` and `kind <= FLD_KIND_DOUBLE` can test for them.)
+//
+enum Reb_Field_Kind {
+    FLD_KIND_UINT8,
+    FLD_KIND_INT8,
+    FLD_KIND_UINT16,
+    FLD_KIND_INT16,
+    FLD_KIND_UINT32,
+    FLD_KIND_INT32,
+    FLD_KIND_UINT64,
+    FLD_KIND_INT64,
+    FLD_KIND_FLOAT,
+    FLD_KIND_DOUBLE,
+    FLD_KIND_POINTER,
+    FLD_KIND_REBVAL,
+    FLD_KIND_STRUCT
+};
+
+struct Reb_Field_Access {
+    REBFLD *field;  // for names, ffi_types, and schemas of nested structs
+    REBLEN offset;  // from the start of the containing struct
+    REBLEN wide;  // size of one element
+    REBLEN dimension;  // 0 if not an array
+    enum Reb_Field_Kind kind;
+};
+
 inline static ffi_type* SCHEMA_FFTYPE(const RELVAL *schema) {
     if (IS_BLOCK(schema)) {
         REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(schema);
@@ -268,6 +309,13 @@ typedef REBARR REBSTU;
 
 #define MISC_STU_OFFSET(stu)    (stu)->misc.custom.u32
 
+// The schema of a struct array links to the schema of its elements (see
+// STU_IS_ARRAY()).
+//
+#define LINK_Element_TYPE       REBFLD*
+#define LINK_Element_CAST       ARR
+#define HAS_LINK_Element        FLAVOR_ARRAY
+
 inline static REBFLD *STU_SCHEMA(REBSTU *stu) {
     REBFLD *schema = LINK(Schema, stu);
     assert(FLD_IS_STRUCT(schema));
@@ -319,6 +367,107 @@ inline static bool STU_INACCESSIBLE(REBSTU *stu) {
 }
 
 
+// A shared copy of a BINARY!-backed struct (see Copy_Struct_Managed()) does
+// not copy the data right away.  It is made with the same data cell (and
+// offset) as the source, and gets listed in the LINK() of the BINARY!.
+// Anything about to write the data (or to give out its address, since C
+// could write it) must call Prepare_Struct_For_Write(), which gives every
+// copy still listed its own slice of the bytes first.
+//
+// It has to be the binary that knows its copies, since the source is not the
+// only struct aliasing the data: sub-struct fields and array elements are
+// views sharing the same BINARY! at other offsets, and writes through those
+// must detach the copies too.
+//
+// The list keeps the copies alive until the binary is next written, and that
+// write has to give each of them its own bytes.  So only FFI_STRUCT_SHARES_MAX
+// copies share at once (past that, a copy gets its data right away) to keep
+// dropped copies from piling up, and bound what one write costs.
+//
+// The head of the list is a LOGIC! that is true once the address of the data
+// has been given out (see Prepare_Struct_For_Address()).  C may keep such an
+// address and write through it at any later time, so that data is never
+// shared again.
+//
+#define FFI_STRUCT_SHARES_MAX 8
+
+#define LINK_StructCopies_TYPE  REBARR*
+#define LINK_StructCopies_CAST  ARR
+#define HAS_LINK_StructCopies   FLAVOR_BINARY
+
+inline static bool Is_Struct_Data_Shared(const REBVAL *data) {
+    return IS_BINARY(data)
+        and GET_SERIES_FLAG(VAL_BINARY(data), LINK_NODE_NEEDS_MARK);
+}
+
+inline static bool Is_Struct_Data_Escaped(REBBIN *bin) {
+    return GET_SERIES_FLAG(bin, LINK_NODE_NEEDS_MARK)
+        and VAL_LOGIC(ARR_HEAD(LINK(StructCopies, bin)));
+}
+
+extern void Unshare_Struct_Copies(REBBIN *bin);
+extern void Unshare_Struct_Copy(REBSTU *stu);
+extern void Prepare_Struct_For_Address(REBSTU *stu);
+
+inline static void Prepare_Struct_For_Write(REBSTU *stu) {
+    REBVAL *data = STU_DATA(stu);
+    if (Is_Struct_Data_Shared(data))
+        Unshare_Struct_Copies(VAL_BINARY_KNOWN_MUTABLE(data));
+}
+
+// A view of a struct that is a copy still sharing its data would be a way to
+// write the source's bytes, so such copies are detached before making one.
+//
+inline static void Prepare_Struct_For_View(REBSTU *stu) {
+    if (Is_Struct_Data_Shared(STU_DATA(stu)))
+        Unshare_Struct_Copy(stu);
+}
+
+
+// A "struct array" is a STRUCT! modeling a C array like `struct point p[N]`,
+// with all N elements in one contiguous data blob.  Its schema is a nameless
+// field with a dimension, sharing the fieldlist, ffi_type, and index of the
+// element schema it LINK()s to.  (Sub-structs picked out of an array field
+// also have a schema with a dimension--but it is the named field itself.)
+//
+// Elements are accessed through "views", which are ordinary STRUCT!s with
+// the element schema aliasing the array's data at some offset.  A view can
+// be re-aimed at another element just by changing its STU_OFFSET().
+//
+inline static bool STU_IS_ARRAY(REBSTU *stu) {
+    REBFLD *schema = STU_SCHEMA(stu);
+    return FLD_NAME(schema) == nullptr and FLD_IS_ARRAY(schema);
+}
+
+inline static REBLEN STU_ARRAY_LEN(REBSTU *stu) {
+    assert(STU_IS_ARRAY(stu));
+    return FLD_DIMENSION(STU_SCHEMA(stu));
+}
+
+inline static REBFLD *STU_ELEMENT_SCHEMA(REBSTU *stu) {
+    assert(STU_IS_ARRAY(stu));
+    return LINK(Element, STU_SCHEMA(stu));
+}
+
+// Bytes from one element to the next.  Usually the element's size, but an
+// array overlaid on C memory whose records are padded apart (or which are
+// a prefix of larger records) can have a wider stride.
+//
+inline static REBLEN STU_ARRAY_STRIDE(REBSTU *stu) {
+    assert(STU_IS_ARRAY(stu));
+    return FLD_WIDE(STU_SCHEMA(stu));
+}
+
+// Number of bytes the value covers from its offset (STU_SIZE() is just the
+// size of one element for an array).
+//
+inline static REBLEN STU_TOTAL_SIZE(REBSTU *stu) {
+    if (STU_IS_ARRAY(stu))
+        return FLD_LEN_BYTES_TOTAL(STU_SCHEMA(stu));
+    return STU_SIZE(stu);
+}
+
+
 // Just as with the varlist of an object, the struct's data is a node for the
 // instance that points to the schema.
 //
@@ -365,8 +514,7 @@ inline static REBVAL *Init_Struct(RELVAL *out, REBSTU *stu) {
     assert(GET_SERIES_FLAG(stu, MANAGED));
 
     RESET_CUSTOM_CELL(out, EG_Struct_Type, CELL_FLAG_FIRST_IS_NODE);
-    INIT_VAL_NODE1(out, stu);
-    VAL_STRUCT_OFFSET(out) = 0;
+    INIT_VAL_NODE1(out, stu);  // offset is in the stu, callers must set it
     return SPECIFIC(out);
 }
 
@@ -390,6 +538,10 @@ enum {
     // not an ffi_closure* for some reason.  Perhaps because it takes a
     // size that might be bigger than the size of a closure?)
     //
+    // A routine made with MAKE-ROUTINE/LAZY has BLANK! here until the first
+    // time it's used.  Nothing else that depends on the symbol or the CIF is
+    // filled in before then either; see Bind_Lazy_Routine().
+    //
     IDX_ROUTINE_CFUNC = 0,
 
     // An INTEGER! indicating which ABI is used by the CFUNC (enum ffi_abi)
@@ -421,30 +573,258 @@ enum {
     // InterFace (CIF) for a C function with fixed arguments can be created
     // once and then used many times.  For a variadic routine, it must be
     // created on each call to match the number and types of arguments.
+    // (Also BLANK! for a lazy routine that hasn't been bound yet.)
     //
     IDX_ROUTINE_CIF = 5,
 
+    // A HANDLE! containing a Reb_Routine_Layout, or BLANK! if variadic.  Once
+    // the CIF is prepared the size and alignment of every argument is known,
+    // so where each one goes in the argument store can be worked out ahead
+    // of time instead of growing a series on each call.
+    //
+    IDX_ROUTINE_LAYOUT = 6,
+
     // A HANDLE! which is actually an array of ffi_type*, so a C array of
     // pointers.  This array was passed into the CIF at its creation time,
     // and it holds references to them as long as you use that CIF...so this
     // array must survive as long as the CIF does.  BLANK! if variadic.
     //
-    IDX_ROUTINE_ARG_FFTYPES = 6,
+    IDX_ROUTINE_ARG_FFTYPES = 7,
 
     // A LOGIC! of whether this routine is variadic.  Since variadic-ness is
     // something that gets exposed in the ACTION! interface itself, this
     // may become redundant as an internal property of the implementation.
     //
-    IDX_ROUTINE_IS_VARIADIC = 7,
+    IDX_ROUTINE_IS_VARIADIC = 8,
+
+    // A HANDLE! of the Reb_Closure_Slot whose ffi_closure for a callback
+    // stores the place where the CFUNC* lives, or BLANK! if the routine does
+    // not have a callback interface.  (Also BLANK! for callbacks made with
+    // WRAP-CALLBACK/CONTEXT, which share their signature's closure.)
+    //
+    IDX_ROUTINE_CLOSURE = 9,
+
+    // A HANDLE! to a Reb_Cif_Cache if the routine is variadic, else BLANK!.
+    // Each distinct sequence of variadic argument types needs its own CIF,
+    // but in practice a call site like a logging printf only uses a few of
+    // them...so recently used CIFs are kept instead of re-prepping them.
+    //
+    IDX_ROUTINE_CIF_CACHE = 10,
+
+    // For a callback, a BLOCK! of the ACTION! followed by a cell for each
+    // argument, which is refilled and run on each call from C instead of
+    // making a new array.  It is taken out of the slot (leaving BLANK!) while
+    // it runs, so a callback which reenters itself makes a fresh one.  Also
+    // BLANK! before the first call, and always for routines.
+    //
+    IDX_ROUTINE_INVOCATION = 11,
+
+    // For a callback made with WRAP-CALLBACK/FOREIGN, a HANDLE! holding the
+    // Reb_Foreign_Callback that foreign threads are given as closure data.
+    // BLANK! for any other routine or callback.  See %c-thread.c
+    //
+    IDX_ROUTINE_FOREIGN = 12,
+
+    // A LOGIC! of whether the routine's spec marked it <reentrant>, which
+    // means it's safe to call from several threads at once (so it may be
+    // used with CALL-MANY/PARALLEL).
+    //
+    IDX_ROUTINE_IS_REENTRANT = 13,
+
+    // An INTEGER! of the Reb_Thunk_Kind used to call the CFUNC.  Routines
+    // with a simple enough signature are called through a C function
+    // pointer cast to the exact type instead of with ffi_call().
+    //
+    IDX_ROUTINE_THUNK = 14,
+
+    // A HANDLE! to the Reb_Ffi_Stats of the routine or callback, or BLANK!
+    // if the extension was built with FFI_NO_STATS.
+    //
+    IDX_ROUTINE_STATS = 15,
 
-    // An ffi_closure which for a callback stores the place where the CFUNC*
-    // lives, or BLANK! if the routine does not have a callback interface.
+    // The TEXT! linker name of the function, for a routine made from a
+    // LIBRARY! with MAKE-ROUTINE.  BLANK! for raw routines and callbacks.
+    // This is what a lazy routine looks up, and what a binding image saves.
     //
-    IDX_ROUTINE_CLOSURE = 8,
+    IDX_ROUTINE_NAME = 16,
+
+    // BLANK! unless the spec has `[out T]` or `[inout T]` arguments, which
+    // are C `T*` parameters whose pointee lives in the argument store.  Then
+    // it's a BLOCK! with a triple for each such argument, in order: the
+    // 0-based INTEGER! argument index, a LOGIC! of whether it is `inout`
+    // (takes an initial value), and the WORD! of the scalar type T.
+    //
+    IDX_ROUTINE_OUT_PARAMS = 17,
+
+    // BLANK! unless the spec has `[utf8]` or `[utf16]` arguments, which are
+    // passed as NUL-terminated strings.  Then it's a BLOCK! of four cells
+    // for each one: the 0-based INTEGER! argument index, the INTEGER! of its
+    // Reb_Text_Encoding, and the last immutable TEXT! that was converted for
+    // it along with the BINARY! it converted to (BLANK!s until there is one).
+    //
+    IDX_ROUTINE_TEXT_PARAMS = 18,
+
+    // An INTEGER! of the Reb_Text_Encoding of a `[utf8]` or `[utf16]` return.
+    // BLANK! if the return type isn't text.
+    //
+    IDX_ROUTINE_TEXT_RETURN = 19,
+
+    // For a return type of `[utf8 free (:routine)]` or `[utf16 free ...]`,
+    // the ACTION! of the routine that the returned string is passed to once
+    // it is decoded.  This has to come from the library (or share its C
+    // runtime), since the extension's own free() can't release memory that
+    // another runtime allocated.  BLANK! if the string isn't freed.
+    //
+    IDX_ROUTINE_TEXT_FREE = 20,
+
+    // A LOGIC! of whether the spec had an <into> tag, giving the routine a
+    // last argument of a STRUCT! to write its struct return value into (see
+    // Alloc_Ffi_Action_For_Spec()).
+    //
+    IDX_ROUTINE_HAS_INTO = 21,
+
+    // For a callback made with WRAP-CALLBACK/CONTEXT, a HANDLE! whose
+    // pointer is the callback's context pointer (see CALLBACK-CONTEXT), and
+    // whose GC frees its entry in the context table.  BLANK! for any other
+    // routine or callback, which have no context.
+    //
+    IDX_ROUTINE_CONTEXT = 22,
 
     IDX_ROUTINE_MAX
 };
 
+
+// The argument store for a non-variadic call is a single block of memory,
+// with the return slot at the head and each argument at an offset that
+// respects the alignment libffi computed for its type.  This is allocated
+// with a variable number of `arg_offsets`, one per fixed argument.
+//
+struct Reb_Routine_Layout {
+    REBLEN store_size;  // total bytes needed, including the return slot
+    REBLEN ret_offset;  // where the return value is written (if not void)
+    REBLEN out_offset;  // pointees of out params, FFI_OUT_SLOT_SIZE apiece
+    REBLEN num_args;
+    REBLEN arg_offsets[1];  // actually `num_args` entries
+};
+
+#define FFI_OUT_SLOT_SIZE 8  // any scalar an `[out T]` can point to fits
+
+
+// How a TEXT! argument or return value is represented in C.
+//
+enum Reb_Text_Encoding {
+    FFI_TEXT_UTF8,  // `char*`
+    FFI_TEXT_UTF16  // `uint16_t*` (e.g. `wchar_t*` on Windows)
+};
+
+#define SIZEOF_ROUTINE_LAYOUT(num_args) \
+    (sizeof(struct Reb_Routine_Layout) \
+        + ((num_args) == 0 ? 0 : (num_args) - 1) * sizeof(REBLEN))
+
+
+// Variadic CIFs are cached by the sequence of type words given for the
+// variadic arguments (e.g. `[pointer] [int32]`).  Only sequences made of
+// plain type words are cached--a `[struct! [...]]` type could get GC'd and
+// take its ffi_type with it, so those calls re-prep every time.
+//
+#define FFI_CIF_CACHE_SIZE 16  // distinct signatures remembered per routine
+#define FFI_CIF_CACHE_MAX_ARGS 16  // longer variadic sequences aren't cached
+
+struct Reb_Cif_Cache_Entry {
+    ffi_cif cif;
+    ffi_type **args_fftypes;  // fixed + variadic, nullptr if entry unused
+    REBLEN num_variable;
+    SYMID syms[FFI_CIF_CACHE_MAX_ARGS];
+    uint32_t last_used;  // tick of the cache when last hit, for LRU eviction
+};
+
+struct Reb_Cif_Cache {
+    REBI64 hits;
+    REBI64 misses;
+    uint32_t tick;
+    struct Reb_Cif_Cache_Entry entries[FFI_CIF_CACHE_SIZE];
+};
+
+// Allocating an ffi_closure typically costs a slot in a page that's mapped
+// both writable and executable, and short-lived callbacks would churn those
+// mappings.  So when a callback is GC'd its closure is kept in a pool to be
+// re-prepped for the next one (a closure can be prepped with any CIF).
+//
+#define FFI_CLOSURE_POOL_MAX 256  // idle closures kept, beyond are freed
+
+struct Reb_Closure_Slot {
+    ffi_closure *closure;
+    void *thunk;  // executable address of the closure (may not be `closure`)
+    struct Reb_Closure_Slot *next_free;  // link while idle in the pool
+};
+
+struct Reb_Closure_Pool {
+    struct Reb_Closure_Slot *free;  // idle closures, most recently freed first
+    REBLEN num_free;
+    REBLEN num_live;  // held by callbacks that haven't been GC'd
+    REBI64 created;  // got from ffi_closure_alloc()
+    REBI64 reused;  // got from the pool instead
+};
+
+extern struct Reb_Closure_Pool Closure_Pool;
+
+// C APIs which pass a `void *user_data` through to their callbacks don't
+// need a closure per callback to know which one is being called.  Callbacks
+// made with WRAP-CALLBACK/CONTEXT share one closure and one CIF for each
+// distinct signature, and the user data is a "context pointer" that the
+// shared closure looks the callback up by in a table.  So making and GC'ing
+// them never touches executable memory.
+//
+// The context pointer isn't an address, but the table index plus one along
+// with a count of how many times that entry has been reused.  So a stale
+// one that C code calls with after its callback was GC'd is caught instead
+// of running some newer callback.
+//
+#define FFI_CONTEXT_INDEX_BITS 20  // up to a million live context callbacks
+#define FFI_CONTEXT_MAX_ARGS 16  // longer signatures can't be shared
+
+struct Reb_Callback_Signature {
+    ffi_cif cif;
+    ffi_type *args_fftypes[FFI_CONTEXT_MAX_ARGS];
+    struct Reb_Closure_Slot *slot;  // the closure every callback shares
+    ffi_abi abi;
+    REBLEN context_index;  // which argument is the context pointer
+    SYMID ret_sym;  // SYM_0 if void
+    SYMID arg_syms[FFI_CONTEXT_MAX_ARGS];
+    struct Reb_Callback_Signature *next;
+};
+
+struct Reb_Context_Entry {
+    REBRIN *rin;  // nullptr if the entry is free
+    uintptr_t reuses;  // bumped each time the entry is freed
+    REBLEN next_free;  // index of the next free entry, while free
+};
+
+// The signatures that are called directly instead of with ffi_call().
+// "INT" means any integer or pointer type no wider than a pointer, which
+// for the default ABI of every supported platform is passed and returned in
+// a register (or stack slot) the same way as `intptr_t`.  The `_N` is the
+// number of arguments.  Floating point is only `double`, for math routines.
+//
+enum Reb_Thunk_Kind {
+    FFI_THUNK_NONE = 0,  // use ffi_call()
+
+    FFI_THUNK_VOID_0,
+    FFI_THUNK_VOID_1,
+    FFI_THUNK_VOID_2,
+    FFI_THUNK_VOID_3,
+    FFI_THUNK_VOID_4,
+
+    FFI_THUNK_INT_0,
+    FFI_THUNK_INT_1,
+    FFI_THUNK_INT_2,
+    FFI_THUNK_INT_3,
+    FFI_THUNK_INT_4,
+
+    FFI_THUNK_DOUBLE_1,
+    FFI_THUNK_DOUBLE_2
+};
+
 #define RIN_AT(a,n) \
     SER_AT(REBVAL, (a), (n))  // locate index access
 
@@ -466,7 +846,9 @@ inline static bool RIN_IS_CALLBACK(REBRIN *r) {
 
 inline static ffi_closure* RIN_CLOSURE(REBRIN *r) {
     assert(RIN_IS_CALLBACK(r)); // only callbacks have ffi_closure
-    return VAL_HANDLE_POINTER(ffi_closure, RIN_AT(r, IDX_ROUTINE_CLOSURE));
+    return VAL_HANDLE_POINTER(
+        struct Reb_Closure_Slot, RIN_AT(r, IDX_ROUTINE_CLOSURE)
+    )->closure;
 }
 
 inline static REBLIB *RIN_LIB(REBRIN *r) {
@@ -492,9 +874,38 @@ inline static REBVAL *RIN_ARG_SCHEMA(REBRIN *r, REBLEN n) { // 0-based index
     return cast(REBVAL*, ARR_AT(VAL_ARRAY_KNOWN_MUTABLE(arg_schemas), n));
 }
 
+inline static REBARR *RIN_OUT_PARAMS(REBRIN *r) {  // nullptr if none
+    REBVAL *outs = RIN_AT(r, IDX_ROUTINE_OUT_PARAMS);
+    return IS_BLANK(outs) ? nullptr : VAL_ARRAY_KNOWN_MUTABLE(outs);
+}
+
+inline static REBARR *RIN_TEXT_PARAMS(REBRIN *r) {  // nullptr if none
+    REBVAL *texts = RIN_AT(r, IDX_ROUTINE_TEXT_PARAMS);
+    return IS_BLANK(texts) ? nullptr : VAL_ARRAY_KNOWN_MUTABLE(texts);
+}
+
+// Out parameters, text conversions and <into> are only done by the routine
+// dispatcher, so the other ways of calling a routine (CALL-MANY, CALL-ASYNC)
+// or making one (callbacks, binding images) don't allow them.
+//
+inline static bool RIN_HAS_CONVERSIONS(REBRIN *r) {
+    return not (
+        IS_BLANK(RIN_AT(r, IDX_ROUTINE_OUT_PARAMS))
+        and IS_BLANK(RIN_AT(r, IDX_ROUTINE_TEXT_PARAMS))
+        and IS_BLANK(RIN_AT(r, IDX_ROUTINE_TEXT_RETURN))
+        and not VAL_LOGIC(RIN_AT(r, IDX_ROUTINE_HAS_INTO))
+    );
+}
+
 inline static ffi_cif *RIN_CIF(REBRIN *r)
     { return VAL_HANDLE_POINTER(ffi_cif, RIN_AT(r, IDX_ROUTINE_CIF)); }
 
+inline static const struct Reb_Routine_Layout *RIN_LAYOUT(REBRIN *r) {
+    return VAL_HANDLE_POINTER(
+        struct Reb_Routine_Layout, RIN_AT(r, IDX_ROUTINE_LAYOUT)
+    );
+}
+
 inline static ffi_type** RIN_ARG_FFTYPES(REBRIN *r) {
     return VAL_HANDLE_POINTER(ffi_type*, RIN_AT(r, IDX_ROUTINE_ARG_FFTYPES));
 }
@@ -502,6 +913,88 @@ inline static ffi_type** RIN_ARG_FFTYPES(REBRIN *r) {
 inline static bool RIN_IS_VARIADIC(REBRIN *r)
     { return VAL_LOGIC(RIN_AT(r, IDX_ROUTINE_IS_VARIADIC)); }
 
+inline static bool RIN_IS_REENTRANT(REBRIN *r)
+    { return VAL_LOGIC(RIN_AT(r, IDX_ROUTINE_IS_REENTRANT)); }
+
+inline static enum Reb_Thunk_Kind RIN_THUNK(REBRIN *r) {
+    return cast(
+        enum Reb_Thunk_Kind, VAL_INT32(RIN_AT(r, IDX_ROUTINE_THUNK))
+    );
+}
+
+inline static struct Reb_Cif_Cache *RIN_CIF_CACHE(REBRIN *r) {
+    assert(RIN_IS_VARIADIC(r));
+    return VAL_HANDLE_POINTER(
+        struct Reb_Cif_Cache, RIN_AT(r, IDX_ROUTINE_CIF_CACHE)
+    );
+}
+
+
+// The extension can't add words to the core's symbol table (%words.r), so
+// a word of its own (whose VAL_WORD_ID() is SYM_0) is checked by spelling.
+// Tags in a routine spec like <reentrant> are matched the same way.
+//
+inline static bool Word_Is_Spelled(const RELVAL *word, const char *spelling)
+    { return 0 == strcmp(STR_UTF8(VAL_WORD_SYMBOL(word)), spelling); }
+
+inline static bool Tag_Is_Spelled(const RELVAL *tag, const char *spelling)
+    { return 0 == strcmp(cs_cast(VAL_UTF8_AT(tag)), spelling); }
+
+
+// Profiling counters, updated only while PROFILE-FFI is on (so when it's
+// off, what's left is testing one global per call).  A build can define
+// FFI_NO_STATS to compile the counting out altogether.
+//
+// For a routine, "marshal" is converting the arguments into the store, the
+// "call" is ffi_call() itself (including any callbacks the C code makes),
+// and "convert" is making the result back into a Rebol value.  For a
+// callback it's the other way around: marshal is making Rebol values of the
+// C arguments, the call is running the Rebol action, and convert is turning
+// its result into C.
+//
+struct Reb_Ffi_Stats {
+    REBI64 calls;
+    REBI64 marshal_ns;
+    REBI64 call_ns;
+    REBI64 convert_ns;
+    REBI64 store_bytes;  // routines: argument store bytes marshalled into
+    REBI64 cif_preps;  // variadic routines: calls that had to prep a CIF
+    REBI64 reentries;  // callbacks: calls made while already running
+    REBI64 depth;  // callbacks: calls running now (kept even when off)
+};
+
+extern bool Ffi_Stats_On;
+
+inline static struct Reb_Ffi_Stats *RIN_STATS(REBRIN *r) {
+  #if defined(FFI_NO_STATS)
+    UNUSED(r);
+    return nullptr;
+  #else
+    return VAL_HANDLE_POINTER(
+        struct Reb_Ffi_Stats, RIN_AT(r, IDX_ROUTINE_STATS)
+    );
+  #endif
+}
+
+// What instrumented code asks for: the counters to update, or nullptr if
+// it isn't being profiled.  (Constant nullptr for FFI_NO_STATS builds lets
+// the compiler drop the timing code.)
+//
+inline static struct Reb_Ffi_Stats *Ffi_Stats_If_On(REBRIN *r) {
+  #if defined(FFI_NO_STATS)
+    UNUSED(r);
+    return nullptr;
+  #else
+    return Ffi_Stats_On ? RIN_STATS(r) : nullptr;
+  #endif
+}
+
+
+// Bulk conversions (see %c-bulk.c) go through buffers of this many int64_t
+// or double on the C stack.
+//
+#define FFI_BULK_CHUNK 64
+
 
 // !!! FORWARD DECLARATIONS
 //
@@ -510,16 +1003,45 @@ inline static bool RIN_IS_VARIADIC(REBRIN *r)
 // extension.  Maintain manually for the moment.
 //
 
-extern REBSTU *Copy_Struct_Managed(REBSTU *src);
+extern REBSTU *Copy_Struct_Managed(REBSTU *src, bool share);
 extern void Init_Struct_Fields(REBVAL *ret, REBVAL *spec);
-extern REBACT *Alloc_Ffi_Action_For_Spec(REBVAL *ffi_spec, ffi_abi abi);
+extern void Shutdown_Struct_Interning(void);
+extern void Shutdown_Pinned_Storage(void);
+extern REBVAL *Init_Struct_Array(
+    RELVAL *out,
+    REBSTU *element,
+    REBLEN count,
+    REBLEN stride,
+    uintptr_t raw_addr
+);
+extern REBVAL *Init_Struct_View(RELVAL *out, REBSTU *array, REBLEN index);
+extern void Move_Struct_View(REBSTU *view, REBSTU *array, REBLEN index);
+extern REBACT *Alloc_Ffi_Action_For_Spec(
+    REBVAL *ffi_spec,
+    ffi_abi abi,
+    bool lazy
+);
+extern REBACT *Alloc_Ffi_Action_For_Schemas(
+    REBARR *args_schemas,
+    const REBSTR **arg_names,
+    const REBVAL *ret_schema,
+    ffi_abi abi,
+    bool is_variadic,
+    bool is_reentrant,
+    bool lazy
+);
 extern void callback_dispatcher(
     ffi_cif *cif,
     void *ret,
     void **args,
     void *user_data
 );
+extern void Shutdown_Arg_Store(void);
+extern struct Reb_Closure_Slot *Claim_Closure_Slot(void);
 extern void cleanup_ffi_closure(const REBVAL *v);
+extern void Shutdown_Closure_Pool(void);
+extern void Init_Context_Callback(REBRIN *r, REBLEN context_index);
+extern void Shutdown_Callback_Contexts(void);
 
 extern REB_R T_Struct(REBFRM *frame_, const REBVAL *verb);
 extern REB_R PD_Struct(REBPVS *pvs, const RELVAL* picker, const REBVAL *opt_setval);
@@ -528,8 +1050,93 @@ extern REB_R MAKE_Struct(REBVAL *out, enum Reb_Kind kind,const REBVAL *opt_paren
 extern REB_R TO_Struct(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
 extern void MF_Struct(REB_MOLD *mo, REBCEL(const*) v, bool form);
 
+extern REBVAL *Map_Struct_File(
+    REBVAL *out,
+    REBSTU *element,
+    const REBVAL *path,
+    REBI64 offset,
+    option(const REBVAL*) count,
+    bool write,
+    option(const REBVAL*) advise
+);
+extern void Flush_Struct_Map(const REBVAL *stu_value);
+extern void Unmap_Struct(const REBVAL *stu_value);
+
+extern bool Init_Scalar_Field_Type(REBFLD *field, SYMID sym);
+extern void Init_Struct_Field_Type(REBFLD *field, REBFLD *schema, REBLEN wide);
+extern REBFLD *Make_Field(const REBSTR *name, REBLEN offset);
+extern REBFLD *Make_Struct_Schema(REBARR *fieldlist, REBLEN size);
+extern bool Struct_Matches_Schema(const REBVAL *stu, REBFLD *schema);
+extern REBVAL *Init_Struct_For_Schema(
+    RELVAL *out,
+    REBFLD *schema,
+    const REBYTE *data
+);
+extern REBVAL *Encode_Ffi_Image(REBVAL *out, const REBVAL *entries);
+extern REBVAL *Decode_Ffi_Image(
+    REBVAL *out,
+    const REBVAL *image,
+    const REBVAL *lib
+);
+
+extern void Bulk_Load_Int64(
+    int64_t *dest,
+    const void *src,
+    enum Reb_Field_Kind kind,
+    REBLEN n
+);
+extern bool Bulk_Store_Int64(
+    void *dest,
+    enum Reb_Field_Kind kind,
+    const int64_t *src,
+    REBLEN n
+);
+extern void Bulk_Load_Double(
+    double *dest,
+    const void *src,
+    enum Reb_Field_Kind kind,
+    REBLEN n
+);
+extern void Bulk_Store_Double(
+    void *dest,
+    enum Reb_Field_Kind kind,
+    const double *src,
+    REBLEN n
+);
+
+extern REBVAL *Peek_Scalar_At(REBVAL *out, const void *p, SYMID sym);
+extern void Poke_Scalar_At(void *p, SYMID sym, const REBVAL *val);
+
+extern bool Vector_Matches_FFType(const RELVAL *vec, ffi_type *fftype);
+extern REBVAL *Make_Vector_For_FFType(ffi_type *fftype, REBLEN len);
+
 extern REB_R Routine_Dispatcher(REBFRM *f);
+extern void Call_Routine_Many(
+    REBVAL *out,
+    const REBVAL *routine,
+    const REBVAL *columns,
+    option(const REBVAL*) into,
+    bool parallel
+);
+extern void Call_Routine_Async(
+    REBVAL *out,
+    const REBVAL *routine,
+    const REBVAL *arguments
+);
+extern bool Is_Async_Call_Done(const REBVAL *job);
+extern REBVAL *Finish_Async_Call(REBVAL *out, const REBVAL *job);
+extern void Shutdown_Async_Calls(void);
 
 inline static bool IS_ACTION_RIN(const RELVAL *v)
     { return ACT_DISPATCHER(VAL_ACTION(v)) == &Routine_Dispatcher; }
 
+extern void Bind_Lazy_Routine(REBRIN *r);
+
+// Anything that needs the CFUNC* or the CIF of a routine has to call this
+// first, in case it came from MAKE-ROUTINE/LAZY (or BIND-LIBRARY).
+//
+inline static void Ensure_Routine_Bound(REBRIN *r) {
+    if (IS_BLANK(RIN_AT(r, IDX_ROUTINE_CFUNC)))
+        Bind_Lazy_Routine(r);
+}
+
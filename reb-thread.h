@@ -0,0 +1,191 @@
+//
+//  File: %reb-thread.h
+//  Summary: "Minimal atomics and thread primitives used by the FFI"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2014-2017 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// The interpreter itself is single-threaded, but C libraries called through
+// the FFI are not.  Code which has to cope with that (e.g. callbacks that
+// are invoked from a library's own worker threads) needs a few atomic
+// operations and a way to identify and yield the current thread.
+//
+// This deliberately doesn't try to be a general threading layer.  The
+// atomics are only for `uintptr_t` sized words, and the rest is implemented
+// in %c-thread.c so that <windows.h> and <pthread.h> don't leak into every
+// file that includes this header.
+//
+// !!! C11 <stdatomic.h> would be the standard answer, but the rest of the
+// codebase still builds as C99 and C++98, and MSVC's C mode lacks it.
+//
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+
+    // On x86 and x64 MSVC treats volatile accesses as acquire loads and
+    // release stores (the /volatile:ms default), and the compiler barrier
+    // keeps it from moving other accesses across them.
+    //
+    inline static uintptr_t Atomic_Load_Acquire(volatile uintptr_t *p) {
+        uintptr_t v = *p;
+        _ReadWriteBarrier();
+        return v;
+    }
+
+    inline static void Atomic_Store_Release(
+        volatile uintptr_t *p,
+        uintptr_t v
+    ){
+        _ReadWriteBarrier();
+        *p = v;
+    }
+
+    // Compare *p with *expected, and if equal store desired and return true.
+    // If not equal, *expected is updated with what was actually in *p.
+    //
+    inline static bool Atomic_Compare_Exchange(
+        volatile uintptr_t *p,
+        uintptr_t *expected,
+        uintptr_t desired
+    ){
+      #if defined(_WIN64)
+        uintptr_t old = cast(uintptr_t, _InterlockedCompareExchange64(
+            cast(volatile __int64*, p), desired, *expected
+        ));
+      #else
+        uintptr_t old = cast(uintptr_t, _InterlockedCompareExchange(
+            cast(volatile long*, p), desired, *expected
+        ));
+      #endif
+        if (old == *expected)
+            return true;
+        *expected = old;
+        return false;
+    }
+
+    inline static uintptr_t Atomic_Fetch_Add(
+        volatile uintptr_t *p,
+        uintptr_t n
+    ){
+      #if defined(_WIN64)
+        return cast(uintptr_t, _InterlockedExchangeAdd64(
+            cast(volatile __int64*, p), n
+        ));
+      #else
+        return cast(uintptr_t, _InterlockedExchangeAdd(
+            cast(volatile long*, p), n
+        ));
+      #endif
+    }
+#else
+    // GCC and Clang (and compilers imitating them, like TCC and ICC) offer
+    // the C++11 memory model through builtins, in both C and C++ builds.
+    //
+    inline static uintptr_t Atomic_Load_Acquire(volatile uintptr_t *p)
+        { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+
+    inline static void Atomic_Store_Release(
+        volatile uintptr_t *p,
+        uintptr_t v
+    ){
+        __atomic_store_n(p, v, __ATOMIC_RELEASE);
+    }
+
+    inline static bool Atomic_Compare_Exchange(
+        volatile uintptr_t *p,
+        uintptr_t *expected,
+        uintptr_t desired
+    ){
+        return __atomic_compare_exchange_n(
+            p, expected, desired,
+            false,  // not "weak" (callers loop anyway, but keep it simple)
+            __ATOMIC_ACQ_REL,
+            __ATOMIC_ACQUIRE
+        );
+    }
+
+    inline static uintptr_t Atomic_Fetch_Add(
+        volatile uintptr_t *p,
+        uintptr_t n
+    ){
+        return __atomic_fetch_add(p, n, __ATOMIC_ACQ_REL);
+    }
+#endif
+
+
+// Whether the caller is on the thread that runs the interpreter, as noted by
+// Startup_Foreign_Callbacks().  (None of the REBVAL or series machinery may
+// be touched from any other thread, including the memory allocator.)
+//
+extern bool On_Interpreter_Thread(void);
+
+// Give up the rest of the current thread's timeslice.  Used by threads that
+// are waiting on the interpreter, which may take a while to get around to
+// servicing them (so spinning would just burn a core).
+//
+extern void Ffi_Yield_Thread(void);
+
+
+// A monotonic clock in nanoseconds (from an arbitrary starting point), for
+// the profiling counters.
+//
+extern REBI64 Ffi_Nanoseconds(void);
+
+
+// A unit of work for the FFI's worker threads.  Embed this as the first
+// member of a struct carrying what `run` needs.  See %c-thread.c
+//
+enum Reb_Ffi_Pool_Kind {
+    FFI_POOL_COMPUTE,  // CPU-bound work, one thread per online core
+    FFI_POOL_BLOCKING,  // C calls that may block (CALL-ASYNC)
+    FFI_NUM_POOLS
+};
+
+#define FFI_BLOCKING_WORKERS 8  // how many CALL-ASYNC jobs can run at once
+#define FFI_JOB_PUMP_MSEC 1  // how often Wait_Ffi_Job_Pumping() pumps
+
+struct Reb_Ffi_Pool;
+
+struct Reb_Ffi_Job {
+    void (*run)(struct Reb_Ffi_Job *job);  // called on a worker thread
+    volatile uintptr_t done;  // nonzero once `run` has returned
+    struct Reb_Ffi_Job *next;  // queue link, belongs to the pool
+    struct Reb_Ffi_Pool *pool;  // what it was submitted to
+};
+
+
+// !!! FORWARD DECLARATIONS (for %c-thread.c)
+
+extern void Startup_Foreign_Callbacks(void);
+extern void *Init_Foreign_Callback(REBRIN *r);
+extern void foreign_callback_dispatcher(
+    ffi_cif *cif,
+    void *ret,
+    void **args,
+    void *user_data
+);
+extern REBLEN Pump_Foreign_Callbacks(REBLEN limit);
+
+extern REBLEN Num_Ffi_Workers(enum Reb_Ffi_Pool_Kind kind);
+extern void Submit_Ffi_Job(
+    struct Reb_Ffi_Job *job,
+    enum Reb_Ffi_Pool_Kind kind
+);
+extern bool Is_Ffi_Job_Done(struct Reb_Ffi_Job *job);
+extern void Wait_Ffi_Job(struct Reb_Ffi_Job *job);
+extern void Wait_Ffi_Job_Pumping(struct Reb_Ffi_Job *job);
+extern void Shutdown_Ffi_Workers(void);
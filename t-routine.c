@@ -31,6 +31,8 @@
 //
 #include "sys-vector.h"
 
+#include "reb-thread.h"
+
 
 static struct {
     SYMID sym;
@@ -61,6 +63,55 @@ static struct {
 };
 
 
+//
+// The parameter an argument with the given schema gets in the ACTION!, which
+// typechecks for the Rebol types that can be converted to the C type.
+//
+static void Init_Param_For_Schema(
+    RELVAL *param_out,
+    const RELVAL *schema,
+    const REBSTR *spelling
+){
+    if (IS_BLOCK(schema)) {
+        //
+        // !!! Saying any STRUCT! is legal here in the typeset suggests any
+        // structure is legal to pass into a routine.  Yet structs in C
+        // have different sizes (and static type checking so you can't pass
+        // one structure in the place of another.  Actual struct compatibility
+        // is not checked until runtime, when the call happens.
+        //
+        Init_Param(
+            param_out,
+            REB_P_NORMAL,
+            spelling,
+            FLAGIT_KIND(REB_CUSTOM)  // !!! Was REB_STRUCT, must narrow!
+        );
+        return;
+    }
+
+    if (IS_BLANK(schema))  // `[void]`, which is only legal as a return type
+        fail ("FFI: void is only legal as a return type");
+
+    SYMID sym = VAL_WORD_ID(schema);
+
+    int index = 0;
+    for (; ; ++index) {
+        if (syms_to_typesets[index].sym == REB_0)
+            fail ("Invalid FFI type indicator");
+
+        if (Same_Nonzero_Symid(syms_to_typesets[index].sym, sym)) {
+            Init_Param(
+                param_out,
+                REB_P_NORMAL,
+                spelling,
+                syms_to_typesets[index].bits
+            );
+            return;
+        }
+    }
+}
+
+
 //
 // Writes into `schema_out` a Rebol value which describes either a basic FFI
 // type or the layout of a STRUCT! (not including data).
@@ -111,18 +162,11 @@ static void Schema_From_Block_May_Fail(
         //
         Init_Block(schema_out, VAL_STRUCT_SCHEMA(temp));
 
-        // !!! Saying any STRUCT! is legal here in the typeset suggests any
-        // structure is legal to pass into a routine.  Yet structs in C
-        // have different sizes (and static type checking so you can't pass
-        // one structure in the place of another.  Actual struct compatibility
-        // is not checked until runtime, when the call happens.
-        //
         if (spelling)
-            Init_Param(
+            Init_Param_For_Schema(
                 unwrap(param_out),
-                REB_P_NORMAL,
-                unwrap(spelling),
-                FLAGIT_KIND(REB_CUSTOM)  // !!! Was REB_STRUCT, must narrow!
+                schema_out,
+                unwrap(spelling)
             );
         return;
     }
@@ -130,11 +174,10 @@ static void Schema_From_Block_May_Fail(
     if (IS_STRUCT(item)) {
         Init_Block(schema_out, VAL_STRUCT_SCHEMA(item));
         if (spelling)
-            Init_Param(
+            Init_Param_For_Schema(
                 unwrap(param_out),
-                REB_P_NORMAL,
-                unwrap(spelling),
-                FLAGIT_KIND(REB_CUSTOM)  // !!! Was REB_STRUCT, must narrow!
+                schema_out,
+                unwrap(spelling)
             );
         return;
     }
@@ -160,23 +203,98 @@ static void Schema_From_Block_May_Fail(
         Init_Blank(schema_out);
     }
 
-    if (spelling) {
-        int index = 0;
-        for (; ; ++index) {
-            if (syms_to_typesets[index].sym == REB_0)
-                fail ("Invalid FFI type indicator");
+    if (spelling)
+        Init_Param_For_Schema(unwrap(param_out), schema_out, unwrap(spelling));
+}
 
-            if (Same_Nonzero_Symid(syms_to_typesets[index].sym, sym)) {
-                Init_Param(
-                    unwrap(param_out),
-                    REB_P_NORMAL,
-                    unwrap(spelling),
-                    syms_to_typesets[index].bits
-                );
-                break;
-            }
-        }
+
+//
+// `[out T]` and `[inout T]` declare a `T*` argument whose pointee is kept in
+// the argument store, so C can write a result through it without a STRUCT!
+// having to be made for each call.  T must be a scalar type.
+//
+// Returns the symbol of T, or nullptr if the block isn't in this form.
+//
+static const REBSTR *Out_Param_Pointee(bool *inout, const REBVAL *blk)
+{
+    if (VAL_LEN_AT(blk) != 2)
+        return nullptr;
+
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, blk);
+    UNUSED(tail);
+    if (not IS_WORD(item))
+        return nullptr;
+
+    if (Word_Is_Spelled(item, "out"))
+        *inout = false;
+    else if (Word_Is_Spelled(item, "inout"))
+        *inout = true;
+    else
+        return nullptr;
+
+    ++item;
+    if (not IS_WORD(item))
+        fail (blk);
+
+    SYMID sym = VAL_WORD_ID(item);
+    if (
+        sym == SYM_0 or sym == SYM_REBVAL
+        or Get_FFType_For_Sym(sym) == nullptr
+    ){
+        fail ("FFI: [out T] and [inout T] need a scalar type for T");
+    }
+
+    return VAL_WORD_SYMBOL(item);
+}
+
+
+//
+// `[utf8]` and `[utf16]` pass a TEXT! (or NULL) as a NUL-terminated string
+// in that encoding, and as a return type they decode one.  A return type of
+// `[utf8 free (:routine)]` or `[utf16 free (:routine)]` also means the caller
+// owns the string C returns, so once it's decoded it is passed to the given
+// routine (e.g. the library's own free(), composed into the spec).
+//
+// Returns the Reb_Text_Encoding, or -1 if the block isn't one of these.
+// `free_out` gets the deallocator's ACTION!, or BLANK! if there isn't one.
+//
+static int Text_Encoding_For_Block(REBVAL *free_out, const REBVAL *blk)
+{
+    REBLEN len = VAL_LEN_AT(blk);
+    if (len != 1 and len != 2 and len != 3)
+        return -1;
+
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, blk);
+    if (not IS_WORD(item))
+        return -1;
+
+    int encoding;
+    if (Word_Is_Spelled(item, "utf8"))
+        encoding = FFI_TEXT_UTF8;
+    else if (Word_Is_Spelled(item, "utf16"))
+        encoding = FFI_TEXT_UTF16;
+    else
+        return -1;
+
+    Init_Blank(free_out);
+    if (len != 1) {
+        ++item;
+        if (not IS_WORD(item) or not Word_Is_Spelled(item, "free"))
+            fail (blk);
+
+        // There's no telling if the library was built against the same C
+        // runtime as the extension, so a bare `free` can't be trusted.
+        //
+        ++item;
+        if (item == tail or not IS_ACTION(item) or not IS_ACTION_RIN(item))
+            fail (Error_Free_Needs_Routine_Raw());
+
+        Derelativize(free_out, item, VAL_SPECIFIER(blk));
     }
+
+    return encoding;
 }
 
 
@@ -294,12 +412,17 @@ static uintptr_t arg_to_ffi(
         if (not IS_STRUCT(arg))
             fail (Error_Arg_Type(D_FRAME, key, VAL_TYPE(arg)));
 
-        if (STU_SIZE(VAL_STRUCT(arg)) != FLD_WIDE(top))
+        if (
+            STU_IS_ARRAY(VAL_STRUCT(arg))  // would need a `pointer` argument
+            or STU_SIZE(VAL_STRUCT(arg)) != FLD_WIDE(top)
+        ){
             fail (Error_Arg_Type(D_FRAME, key, VAL_TYPE(arg)));
+        }
 
         memcpy(dest, VAL_STRUCT_DATA_AT(arg), STU_SIZE(VAL_STRUCT(arg)));
 
-        TERM_BIN_LEN(store, offset + STU_SIZE(VAL_STRUCT(arg)));
+        if (store)
+            TERM_BIN_LEN(store, offset + STU_SIZE(VAL_STRUCT(arg)));
         return offset;
     }
 
@@ -438,8 +561,13 @@ static uintptr_t arg_to_ffi(
             buffer.ipt = cast(intptr_t, VAL_BYTES_AT(nullptr, arg));
             break;
 
-          case REB_CUSTOM:  // !!! copies a *pointer* (and assumes vector!)
-            buffer.ipt = cast(intptr_t, VAL_VECTOR_HEAD(arg));
+          case REB_CUSTOM:  // !!! copies a *pointer*!
+            if (IS_STRUCT(arg)) {  // e.g. a struct array to pass as `T *p`
+                Prepare_Struct_For_Address(VAL_STRUCT(arg));  // C may keep it
+                buffer.ipt = cast(intptr_t, VAL_STRUCT_DATA_AT(arg));
+            }
+            else  // !!! assumes vector!
+                buffer.ipt = cast(intptr_t, VAL_VECTOR_HEAD(arg));
             break;
 
           case REB_ACTION: {
@@ -447,6 +575,8 @@ static uintptr_t arg_to_ffi(
                 fail (Error_Only_Callback_Ptr_Raw());  // but routines, too
 
             REBRIN *rin = ACT_DETAILS(VAL_ACTION(arg));
+            if (not RIN_IS_CALLBACK(rin))
+                Ensure_Routine_Bound(rin);
             CFUNC* cfunc = RIN_CFUNC(rin);
             size_t sizeof_cfunc = sizeof(cfunc);  // avoid conditional const
             if (sizeof_cfunc != sizeof(intptr_t))  // not necessarily true
@@ -623,221 +753,1103 @@ static void ffi_to_rebol(
 }
 
 
+bool Ffi_Stats_On = false;  // see PROFILE-FFI
+
+
+// Non-variadic routines whose argument store fits in this many bytes will
+// marshal into a buffer on the C stack.  Larger stores (e.g. big structs that
+// are passed by value) use the store arena below, or an allocation if the
+// arena is already in use.
 //
-//  Routine_Dispatcher: C
+#define FFI_STACK_STORE_SIZE 256
+
+// Similarly, the `void*[]` vector handed to ffi_call() is on the C stack
+// unless the routine takes an unusually large number of arguments.
 //
-REB_R Routine_Dispatcher(REBFRM *f)
-{
-    REBRIN *rin = ACT_DETAILS(FRM_PHASE(f));
+#define FFI_STACK_ARGS_MAX 16
 
-    if (RIN_IS_CALLBACK(rin) or RIN_LIB(rin) == nullptr) {
-        //
-        // lib is nullptr when routine is constructed from address directly,
-        // so there's nothing to track whether that gets loaded or unloaded
+
+// The interpreter is single-threaded, so one arena serves as the per-thread
+// store for routine calls that need more than FFI_STACK_STORE_SIZE bytes.  It
+// can't be shared by reentrant calls (e.g. a callback that runs a routine in
+// the middle of ffi_call()), so it remembers which frame claimed it.  If a
+// fail() skipped the release, that frame won't be running any longer and the
+// arena can be reclaimed.
+//
+static REBYTE *Store_Arena = nullptr;
+static REBLEN Store_Arena_Size = 0;
+static REBFRM *Store_Arena_Owner = nullptr;
+
+static bool Is_Frame_Running(REBFRM *target) {
+    REBFRM *f = FS_TOP;
+    for (; f != FS_BOTTOM; f = f->prior) {
+        if (f == target)
+            return true;
     }
-    else {
-        if (IS_LIB_CLOSED(RIN_LIB(rin)))
-            fail (Error_Bad_Library_Raw());
+    return false;
+}
+
+static REBYTE *Try_Claim_Store_Arena(REBFRM *f, REBLEN size) {
+    if (Store_Arena_Owner != nullptr and Is_Frame_Running(Store_Arena_Owner))
+        return nullptr;  // reentrant call, caller must allocate
+
+    if (Store_Arena_Size < size) {
+        free(Store_Arena);
+        Store_Arena = cast(REBYTE*, malloc(size));
+        if (Store_Arena == nullptr) {
+            Store_Arena_Size = 0;
+            Store_Arena_Owner = nullptr;
+            return nullptr;
+        }
+        Store_Arena_Size = size;
     }
 
-    REBLEN num_fixed = RIN_NUM_FIXED_ARGS(rin);
+    Store_Arena_Owner = f;
+    return Store_Arena;
+}
 
-    REBLEN num_variable;
-    REBDSP dsp_orig = DSP; // variadic args pushed to stack, so save base ptr
 
-    if (not RIN_IS_VARIADIC(rin))
-        num_variable = 0;
-    else {
-        // The function specification should have one extra parameter for
-        // the variadic source ("...")
-        //
-        assert(ACT_NUM_PARAMS(FRM_PHASE(f)) == num_fixed + 1);
+//
+//  Shutdown_Arg_Store: C
+//
+void Shutdown_Arg_Store(void)
+{
+    assert(
+        Store_Arena_Owner == nullptr
+        or not Is_Frame_Running(Store_Arena_Owner)
+    );
 
-        REBVAL *vararg = FRM_ARG(f, num_fixed + 1); // 1-based
-        assert(IS_VARARGS(vararg) and FRM_BINDING(f) == UNBOUND);
+    free(Store_Arena);
+    Store_Arena = nullptr;
+    Store_Arena_Size = 0;
+    Store_Arena_Owner = nullptr;
+}
 
-        // Evaluate the VARARGS! feed of values to the data stack.  This way
-        // they will be available to be counted, to know how big to make the
-        // FFI argument series.
-        //
-        do {
-            if (Do_Vararg_Op_Maybe_End_Throws(
-                f->out,
-                VARARG_OP_TAKE,
-                vararg
-            )){
-                return R_THROWN;
-            }
 
-            if (IS_END(f->out))
-                break;
+//
+// libffi widens integral return values that are narrower than a register to
+// a full ffi_arg.  They have to be narrowed back by value (not memcpy'd from
+// the front of the return slot) to be correct on big-endian machines.
+//
+static void Narrow_Ffi_Return(REBYTE *dest, const void *ret, ffi_type *rtype)
+{
+    switch (rtype->type) {
+      case FFI_TYPE_UINT8: {
+        uint8_t u8 = cast(uint8_t, *cast(const ffi_arg*, ret));
+        memcpy(dest, &u8, sizeof(u8));
+        break; }
 
-            Copy_Cell(DS_PUSH(), f->out);
-            SET_END(f->out); // expected by Do_Vararg_Op
-        } while (true);
+      case FFI_TYPE_SINT8: {
+        int8_t i8 = cast(int8_t, *cast(const ffi_sarg*, ret));
+        memcpy(dest, &i8, sizeof(i8));
+        break; }
 
-        // !!! The Atronix va_list interface required a type to be specified
-        // for each argument--achieving what you would get if you used a
-        // C cast on each variadic argument.  Such as:
-        //
-        //     printf reduce ["%d, %f" 10 + 20 [int32] 12.34 [float]]
-        //
-        // While this provides generality, it may be useful to use defaulting
-        // like C's where integer types default to `int` and floating point
-        // types default to `double`.  In the VARARGS!-based syntax it could
-        // offer several possibilities:
-        //
-        //     (printf "%d, %f" (10 + 20) 12.34)
-        //     (printf "%d, %f" [int32 10 + 20] 12.34)
-        //     (printf "%d, %f" [int32] 10 + 20 [float] 12.34)
-        //
-        // For the moment, this is following the idea that there must be
-        // pairings of values and then blocks (though the values are evaluated
-        // expressions).
-        //
-        if ((DSP - dsp_orig) % 2 != 0)
-            fail ("Variadic FFI functions must alternate blocks and values");
+      case FFI_TYPE_UINT16: {
+        uint16_t u16 = cast(uint16_t, *cast(const ffi_arg*, ret));
+        memcpy(dest, &u16, sizeof(u16));
+        break; }
 
-        num_variable = (DSP - dsp_orig) / 2;
-    }
+      case FFI_TYPE_SINT16: {
+        int16_t i16 = cast(int16_t, *cast(const ffi_sarg*, ret));
+        memcpy(dest, &i16, sizeof(i16));
+        break; }
 
-    REBLEN num_args = num_fixed + num_variable;
+      case FFI_TYPE_UINT32: {
+        uint32_t u32 = cast(uint32_t, *cast(const ffi_arg*, ret));
+        memcpy(dest, &u32, sizeof(u32));
+        break; }
 
-    // The FFI arguments are passed by void*.  Those void pointers point to
-    // transformations of the Rebol arguments into ranges of memory of
-    // various sizes.  This is the backing store for those arguments, which
-    // is appended to for each one.  The memory is freed after the call.
-    //
-    // The offsets array has one element for each argument.  These point at
-    // indexes of where each FFI variable resides.  Offsets are used instead
-    // of pointers in case the store has to be resized, which may move the
-    // base of the series.  Hence the offsets must be mutated into pointers
-    // at the last minute before the FFI call.
-    //
-    REBBIN *store = Make_Binary(1);
+      case FFI_TYPE_SINT32: {
+        int32_t i32 = cast(int32_t, *cast(const ffi_sarg*, ret));
+        memcpy(dest, &i32, sizeof(i32));
+        break; }
 
-    void *ret_offset;
-    if (not IS_BLANK(RIN_RET_SCHEMA(rin))) {
-        ret_offset = cast(void*, arg_to_ffi(
-            store, // ffi-converted arg appended here
-            nullptr, // dest pointer must be nullptr if store is non-nullptr
-            nullptr, // arg: none (we're only making space--leave uninitialized)
-            RIN_RET_SCHEMA(rin),
-            nullptr // param: none (it's a return value/output)
-        ));
-    }
-    else {
-        // Shouldn't be used (assigned to nullptr later) but avoid maybe
-        // uninitialized warning.
-        //
-        ret_offset = cast(void*, cast(uintptr_t, 0xDECAFBAD));
+      default:  // 64-bit integers, pointers, and floating point are exact
+        memcpy(dest, ret, rtype->size);
+        break;
     }
+}
 
-    REBSER *arg_offsets;
-    if (num_args == 0)
-        arg_offsets = nullptr;  // don't waste time with the alloc + free
-    else
-        arg_offsets = Make_Series(num_args, FLAVOR_POINTER);
 
-    // First gather the fixed parameters from the frame.  They are known to
-    // be of correct general types (they were checked by Eval_Core for the call)
-    // but a STRUCT! might not be compatible with the type of STRUCT! in
-    // the parameter specification.  They might also be out of range, e.g.
-    // a too-large or negative INTEGER! passed to a uint8.  Could fail() here.
-    //
-  blockscope {
-    REBLEN i = 0;
-    for (; i < num_fixed; ++i) {
-        uintptr_t offset = arg_to_ffi(
-            store,  // ffi-converted arg appended here
-            nullptr,  // dest pointer must be nullptr if store is non-null
-            FRM_ARG(f, i + 1),  // 1-based
-            RIN_ARG_SCHEMA(rin, i),  // 0-based
-            ACT_KEY(FRM_PHASE(f), i + 1)  // 1-based
-        );
+//=//// DIRECT CALL THUNKS /////////////////////////////////////////////////=//
+//
+// The bulk of the C functions people bind take a few integers or pointers
+// and return one (or nothing).  For those, ffi_call()'s walk over the CIF to
+// classify each argument is overhead: the C compiler already knows how to
+// make the call if the CFUNC is cast to the right function pointer type.
+//
+// Every integer type no wider than a pointer is passed as `intptr_t`, having
+// been sign or zero extended like the caller of a prototyped function would.
+// Results are narrowed back to the declared type.
+//
+// !!! Only the default ABI is known to work this way.  On 32-bit x86 that's
+// cdecl, and the STDCALL/FASTCALL variants have to go through libffi.
+//
 
-        // We will convert the offset to a pointer later
-        //
-        *SER_AT(void*, arg_offsets, i) = cast(void*, offset);
-    }
-  }
+typedef void (*FFI_VOID_0)(void);
+typedef void (*FFI_VOID_1)(intptr_t);
+typedef void (*FFI_VOID_2)(intptr_t, intptr_t);
+typedef void (*FFI_VOID_3)(intptr_t, intptr_t, intptr_t);
+typedef void (*FFI_VOID_4)(intptr_t, intptr_t, intptr_t, intptr_t);
+typedef intptr_t (*FFI_INT_0)(void);
+typedef intptr_t (*FFI_INT_1)(intptr_t);
+typedef intptr_t (*FFI_INT_2)(intptr_t, intptr_t);
+typedef intptr_t (*FFI_INT_3)(intptr_t, intptr_t, intptr_t);
+typedef intptr_t (*FFI_INT_4)(intptr_t, intptr_t, intptr_t, intptr_t);
+typedef double (*FFI_DOUBLE_1)(double);
+typedef double (*FFI_DOUBLE_2)(double, double);
+
+static bool Is_Thunk_Int_Schema(const REBVAL *schema)
+{
+    if (not IS_WORD(schema))
+        return false;  // struct by value
 
-    // If an FFI routine takes a fixed number of arguments, then its Call
-    // InterFace (CIF) can be created just once.  This will be in the RIN_CIF.
-    // However a variadic routine requires a CIF that matches the number
-    // and types of arguments for that specific call.
-    //
-    // These pointers need to be freed by HANDLE! cleanup.
-    //
-    ffi_cif *cif;  // pre-made if not variadic, built for this call otherwise
-    ffi_type **args_fftypes = nullptr;  // ffi_type*[] if num_variable > 0
+    switch (VAL_WORD_ID(schema)) {
+      case SYM_UINT8:
+      case SYM_INT8:
+      case SYM_UINT16:
+      case SYM_INT16:
+      case SYM_UINT32:
+      case SYM_INT32:
+      case SYM_POINTER:
+      case SYM_REBVAL:  // passed as a pointer
+        return true;
+
+      case SYM_UINT64:
+      case SYM_INT64:
+        return sizeof(intptr_t) == 8;
 
-    if (not RIN_IS_VARIADIC(rin)) {
-        cif = RIN_CIF(rin);
+      default:
+        return false;
     }
-    else {
-        assert(IS_BLANK(RIN_AT(rin, IDX_ROUTINE_CIF)));
+}
 
-        // CIF creation requires a C array of argument descriptions that is
-        // contiguous across both the fixed and variadic parts.  Start by
-        // filling in the ffi_type*s for all the fixed args.
-        //
-        args_fftypes = rebAllocN(ffi_type*, num_fixed + num_variable);
+static bool Is_Thunk_Double_Schema(const REBVAL *schema)
+  { return IS_WORD(schema) and VAL_WORD_ID(schema) == SYM_DOUBLE; }
 
-        REBLEN i;
-        for (i = 0; i < num_fixed; ++i)
-            args_fftypes[i] = SCHEMA_FFTYPE(RIN_ARG_SCHEMA(rin, i));
 
-        DECLARE_LOCAL (schema);
-        DECLARE_LOCAL (param);
+//
+// Pick the Reb_Thunk_Kind for a routine that isn't variadic, once its arg
+// and return schemas are known.
+//
+static enum Reb_Thunk_Kind Thunk_Kind_For_Routine(REBRIN *r, ffi_abi abi)
+{
+    if (abi != FFI_DEFAULT_ABI)
+        return FFI_THUNK_NONE;
 
-        REBDSP dsp;
-        for (dsp = dsp_orig + 1; i < num_args; dsp += 2, ++i) {
-            //
-            // This param is used with the variadic type spec, and is
-            // initialized as it would be for an ordinary FFI argument.  This
-            // means its allowed type flags are set, which is not really
-            // necessary.  Whatever symbol name is used here will be seen
-            // in error reports.
-            //
-            Schema_From_Block_May_Fail(
-                schema,
-                param, // sets type bits in param
-                DS_AT(dsp + 1), // will error if this is not a block
-                Canon(SYM_ELLIPSIS)
-            );
+    REBLEN num_args = RIN_NUM_FIXED_ARGS(r);
+    const REBVAL *ret_schema = RIN_RET_SCHEMA(r);
 
-            args_fftypes[i] = SCHEMA_FFTYPE(schema);
+    REBLEN i;
+    if (
+        num_args > 0 and num_args <= 2
+        and Is_Thunk_Double_Schema(ret_schema)
+    ){
+        for (i = 0; i < num_args; ++i)
+            if (not Is_Thunk_Double_Schema(RIN_ARG_SCHEMA(r, i)))
+                return FFI_THUNK_NONE;
+
+        return cast(enum Reb_Thunk_Kind, FFI_THUNK_DOUBLE_1 + num_args - 1);
+    }
 
-            *SER_AT(void*, arg_offsets, i) = cast(void*, arg_to_ffi(
-                store,  // data appended to store
-                nullptr,  // dest pointer must be null if store is non-null
-                DS_AT(dsp),  // arg
-                schema,
-                nullptr  // REVIEW: need key for error messages
-            ));
-        }
+    if (num_args > 4)
+        return FFI_THUNK_NONE;
 
-        DS_DROP_TO(dsp_orig);  // done w/args (converted to bytes in `store`)
+    for (i = 0; i < num_args; ++i)
+        if (not Is_Thunk_Int_Schema(RIN_ARG_SCHEMA(r, i)))
+            return FFI_THUNK_NONE;
 
-        cif = rebAlloc(ffi_cif);
+    if (IS_BLANK(ret_schema))
+        return cast(enum Reb_Thunk_Kind, FFI_THUNK_VOID_0 + num_args);
 
-        ffi_status status = ffi_prep_cif_var(  // _var-iadic prep_cif version
-            cif,
-            RIN_ABI(rin),
-            num_fixed,  // just fixed
-            num_args,  // fixed plus variable
-            IS_BLANK(RIN_RET_SCHEMA(rin))
-                ? &ffi_type_void
-                : SCHEMA_FFTYPE(RIN_RET_SCHEMA(rin)),  // return FFI type
-            args_fftypes  // arguments FFI types
-        );
+    if (Is_Thunk_Int_Schema(ret_schema))
+        return cast(enum Reb_Thunk_Kind, FFI_THUNK_INT_0 + num_args);
 
-        if (status != FFI_OK) {
-            rebFree(cif);  // would free automatically on fail
-            rebFree(args_fftypes);  // would free automatically on fail
-            fail ("FFI: Couldn't prep CIF_VAR");
-        }
+    return FFI_THUNK_NONE;
+}
+
+
+// An argument that arg_to_ffi() wrote into the store, widened to intptr_t.
+//
+static intptr_t Load_Thunk_Int(const void *arg, ffi_type *fftype)
+{
+    switch (fftype->type) {
+      case FFI_TYPE_UINT8: return *cast(const uint8_t*, arg);
+      case FFI_TYPE_SINT8: return *cast(const int8_t*, arg);
+      case FFI_TYPE_UINT16: return *cast(const uint16_t*, arg);
+      case FFI_TYPE_SINT16: return *cast(const int16_t*, arg);
+      case FFI_TYPE_UINT32: return *cast(const uint32_t*, arg);
+      case FFI_TYPE_SINT32: return *cast(const int32_t*, arg);
+      default: {  // pointer-sized
+        intptr_t i;
+        memcpy(&i, arg, sizeof(i));
+        return i; }
+    }
+}
+
+
+//
+// Stand-in for ffi_call() for routines that have a Reb_Thunk_Kind.  Leaves
+// the result in `ret` exactly as the declared return type (not widened).
+//
+static void Call_Thunk(
+    REBRIN *rin,
+    enum Reb_Thunk_Kind kind,
+    void *ret,
+    void **args
+){
+    CFUNC *cfunc = RIN_CFUNC(rin);
+    ffi_cif *cif = RIN_CIF(rin);
+
+    if (kind == FFI_THUNK_DOUBLE_1 or kind == FFI_THUNK_DOUBLE_2) {
+        double d0 = *cast(double*, args[0]);
+        double result;
+        if (kind == FFI_THUNK_DOUBLE_1)
+            result = (*cast(FFI_DOUBLE_1, cfunc))(d0);
+        else
+            result = (*cast(FFI_DOUBLE_2, cfunc))(d0, *cast(double*, args[1]));
+        memcpy(ret, &result, sizeof(double));
+        return;
+    }
+
+    intptr_t a[4];
+    REBLEN i;
+    for (i = 0; i < cif->nargs; ++i)
+        a[i] = Load_Thunk_Int(args[i], cif->arg_types[i]);
+
+    intptr_t result;
+    switch (kind) {
+      case FFI_THUNK_VOID_0: (*cast(FFI_VOID_0, cfunc))(); return;
+      case FFI_THUNK_VOID_1: (*cast(FFI_VOID_1, cfunc))(a[0]); return;
+      case FFI_THUNK_VOID_2: (*cast(FFI_VOID_2, cfunc))(a[0], a[1]); return;
+      case FFI_THUNK_VOID_3:
+        (*cast(FFI_VOID_3, cfunc))(a[0], a[1], a[2]);
+        return;
+      case FFI_THUNK_VOID_4:
+        (*cast(FFI_VOID_4, cfunc))(a[0], a[1], a[2], a[3]);
+        return;
+
+      case FFI_THUNK_INT_0: result = (*cast(FFI_INT_0, cfunc))(); break;
+      case FFI_THUNK_INT_1: result = (*cast(FFI_INT_1, cfunc))(a[0]); break;
+      case FFI_THUNK_INT_2:
+        result = (*cast(FFI_INT_2, cfunc))(a[0], a[1]);
+        break;
+      case FFI_THUNK_INT_3:
+        result = (*cast(FFI_INT_3, cfunc))(a[0], a[1], a[2]);
+        break;
+      case FFI_THUNK_INT_4:
+        result = (*cast(FFI_INT_4, cfunc))(a[0], a[1], a[2], a[3]);
+        break;
+
+      default:
+        panic ("Bad FFI thunk kind");
+    }
+
+    // The upper bits of a register holding a narrow result are undefined,
+    // so narrow it like a widened ffi_call() result would be.
+    //
+    ffi_arg widened = cast(ffi_arg, result);
+    Narrow_Ffi_Return(cast(REBYTE*, ret), &widened, cif->rtype);
+}
+
+
+//
+// Aim the pointer argument of an `[out T]` or `[inout T]` at its pointee in
+// the argument store.  An `inout` pointee starts as the argument's value,
+// while one that is just `out` is zeroed (in case C doesn't write it).
+//
+static void Out_Param_To_Ffi(
+    void *dest,  // where the pointer argument goes
+    REBYTE *pointee,
+    const RELVAL *triple,  // see IDX_ROUTINE_OUT_PARAMS
+    const REBVAL *arg,
+    const REBKEY *key
+){
+    memset(pointee, 0, FFI_OUT_SLOT_SIZE);
+    if (VAL_LOGIC(triple + 1))
+        arg_to_ffi(nullptr, pointee, arg, SPECIFIC(triple + 2), key);
+
+    memcpy(dest, &pointee, sizeof(void*));
+}
+
+
+//
+// A routine with out parameters returns a BLOCK! of its C return value
+// (unless that's void) followed by what was left in each pointee.
+//
+static void Init_Out_Params_Result(
+    REBVAL *out,  // holds the C return value, if any
+    REBARR *outs,
+    REBYTE *pointees,
+    bool has_ret
+){
+    REBDSP dsp_orig = DSP;
+    if (has_ret)
+        Copy_Cell(DS_PUSH(), out);
+
+    REBLEN num_outs = ARR_LEN(outs) / 3;
+    REBLEN n;
+    for (n = 0; n < num_outs; ++n)
+        ffi_to_rebol(
+            DS_PUSH(),
+            SPECIFIC(ARR_AT(outs, (n * 3) + 2)),
+            pointees + (n * FFI_OUT_SLOT_SIZE)
+        );
+
+    Init_Block(out, Pop_Stack_Values(dsp_orig));
+}
+
+
+//=//// TEXT CONVERSIONS //////////////////////////////////////////////////=//
+//
+// TEXT! is stored as UTF-8, so a `[utf8]` argument whose TEXT! is immutable
+// can be passed as a pointer to its data: nothing can change or move it.  A
+// mutable one could be modified by a callback during the call, so it gets
+// copied.  `[utf16]` arguments have to be converted, and the conversion of an
+// immutable TEXT! is remembered by the routine (see IDX_ROUTINE_TEXT_PARAMS),
+// so passing the same one again only costs a copy.
+//
+// Copies and conversions go into the argument store, after what the layout
+// uses for the fixed arguments.
+//
+
+inline static bool Is_Text_Immutable(const REBVAL *text)
+  { return Is_Series_Frozen(VAL_SERIES(text)); }
+
+
+// Write the codepoints of a TEXT! as NUL-terminated UTF-16, where `dest` has
+// room for FFI_UTF16_MAX_SIZE() bytes.  Returns the number of bytes written.
+//
+#define FFI_UTF16_MAX_SIZE(text) \
+    ((2 * VAL_LEN_AT(text) + 1) * sizeof(uint16_t))
+
+static REBLEN Encode_Utf16(REBYTE *dest, const REBVAL *text)
+{
+    REBCHR(const*) cp = VAL_UTF8_AT(text);
+    REBLEN len = VAL_LEN_AT(text);
+
+    uint16_t *units = cast(uint16_t*, dest);
+    REBLEN n = 0;
+    for (; len != 0; --len) {
+        REBUNI c;
+        cp = NEXT_CHR(&c, cp);
+        if (c < 0x10000)
+            units[n++] = cast(uint16_t, c);
+        else {  // surrogate pair
+            c -= 0x10000;
+            units[n++] = cast(uint16_t, 0xD800 + (c >> 10));
+            units[n++] = cast(uint16_t, 0xDC00 + (c & 0x3FF));
+        }
+    }
+    units[n++] = 0;
+
+    return n * sizeof(uint16_t);
+}
+
+
+// The UTF-16 for an immutable TEXT!, converted on the first call it's passed
+// to and reused for as long as it's the one passed.
+//
+static const REBYTE *Cached_Utf16(
+    REBSIZ *size_out,
+    RELVAL *entry,  // four cells of IDX_ROUTINE_TEXT_PARAMS
+    const REBVAL *text
+){
+    RELVAL *cached_text = entry + 2;
+    RELVAL *cached_utf16 = entry + 3;
+
+    if (
+        not IS_TEXT(cached_text)
+        or VAL_SERIES(cached_text) != VAL_SERIES(text)
+        or VAL_INDEX(cached_text) != VAL_INDEX(text)
+    ){
+        REBBIN *bin = Make_Binary(FFI_UTF16_MAX_SIZE(text));
+        TERM_BIN_LEN(bin, Encode_Utf16(BIN_HEAD(bin), text));
+
+        Init_Binary(cached_utf16, bin);
+        Copy_Cell(cached_text, text);
+    }
+
+    return VAL_BYTES_AT(size_out, SPECIFIC(cached_utf16));
+}
+
+
+// How many bytes past the layout's store the text arguments of this call
+// need.  This is where any conversions of immutable TEXT!s are made.
+//
+static REBLEN Text_Params_Size(REBFRM *f, REBARR *texts)
+{
+    REBLEN size = 0;
+
+    RELVAL *tail = ARR_TAIL(texts);
+    RELVAL *entry = ARR_HEAD(texts);
+    for (; entry != tail; entry += 4) {
+        const REBVAL *arg = FRM_ARG(f, VAL_INT32(entry) + 1);  // 1-based
+        if (IS_NULLED(arg))
+            continue;
+
+        size += 1;  // in case it has to be aligned for UTF-16
+
+        if (VAL_INT32(entry + 1) == FFI_TEXT_UTF8) {
+            if (not Is_Text_Immutable(arg))
+                size += strlen(cs_cast(VAL_UTF8_AT(arg))) + 1;
+        }
+        else if (Is_Text_Immutable(arg)) {
+            REBSIZ utf16_size;
+            Cached_Utf16(&utf16_size, entry, arg);
+            size += utf16_size;
+        }
+        else
+            size += FFI_UTF16_MAX_SIZE(arg);
+    }
+
+    return size;
+}
+
+
+// Point the text arguments at their strings, copying or converting them into
+// the space after the layout's store which Text_Params_Size() said to add.
+// arg_to_ffi() has already given them a pointer (zero for NULL).
+//
+static void Text_Params_To_Ffi(
+    REBFRM *f,
+    REBARR *texts,
+    void **args,
+    REBYTE *dest
+){
+    RELVAL *tail = ARR_TAIL(texts);
+    RELVAL *entry = ARR_HEAD(texts);
+    for (; entry != tail; entry += 4) {
+        REBLEN index = VAL_INT32(entry);
+        const REBVAL *arg = FRM_ARG(f, index + 1);  // 1-based
+        if (IS_NULLED(arg))
+            continue;
+
+        if (cast(uintptr_t, dest) % 2 != 0)
+            ++dest;
+
+        const void *p;
+        if (VAL_INT32(entry + 1) == FFI_TEXT_UTF8) {
+            const char *utf8 = cs_cast(VAL_UTF8_AT(arg));
+            if (Is_Text_Immutable(arg))
+                p = utf8;
+            else {
+                REBLEN size = strlen(utf8) + 1;
+                memcpy(dest, utf8, size);
+                p = dest;
+                dest += size;
+            }
+        }
+        else if (Is_Text_Immutable(arg)) {
+            REBSIZ size;
+            const REBYTE *utf16 = Cached_Utf16(&size, entry, arg);
+            memcpy(dest, utf16, size);
+            p = dest;
+            dest += size;
+        }
+        else {
+            p = dest;
+            dest += Encode_Utf16(dest, arg);
+        }
+
+        memcpy(args[index], &p, sizeof(void*));
+    }
+}
+
+
+// Decode the string a `[utf8]` or `[utf16]` return type points to, NULL if
+// C returned a null pointer.  If the spec gave a routine to free it with,
+// that gets the pointer afterward.
+//
+static void Text_Return_To_Rebol(
+    REBVAL *out,
+    void *ret,
+    REBINT encoding,
+    const REBVAL *deallocator  // ACTION! of a routine, or BLANK!
+){
+    void *p;
+    memcpy(&p, ret, sizeof(void*));
+
+    if (p == nullptr) {
+        Init_Nulled(out);
+        return;
+    }
+
+    REBVAL *text;
+    if (encoding == FFI_TEXT_UTF8)
+        text = rebText(cast(const char*, p));
+    else
+        text = rebTextWide(cast(const REBWCHAR*, p));
+
+    Copy_Cell(out, text);
+    rebRelease(text);
+
+    if (not IS_BLANK(deallocator)) {
+        DECLARE_LOCAL (pointer);
+        Init_Integer(pointer, cast(intptr_t, p));
+        rebElideQ(rebU(deallocator), pointer, rebEND);
+    }
+}
+
+
+//
+// For a routine with <into>, a struct return value is copied into the STRUCT!
+// given as the last argument (which is then the result).  A loop calling the
+// routine with the same STRUCT! each time then doesn't allocate anything.
+//
+static void Struct_Return_Into(
+    REBVAL *out,
+    const REBVAL *into,
+    const REBVAL *ret_schema,
+    const void *ret
+){
+    REBFLD *schema = VAL_ARRAY_KNOWN_MUTABLE(ret_schema);
+
+    if (not IS_STRUCT(into))
+        fail (Error_Invalid_Type(VAL_TYPE(into)));
+
+    if (
+        STU_IS_ARRAY(VAL_STRUCT(into))
+        or VAL_STRUCT_INACCESSIBLE(into)
+        or not Struct_Matches_Schema(into, schema)
+    ){
+        fail ("FFI: <into> STRUCT! doesn't match the routine's return type");
+    }
+
+    Prepare_Struct_For_Write(VAL_STRUCT(into));
+    memcpy(VAL_STRUCT_DATA_AT(into), ret, FLD_WIDE(schema));
+    Copy_Cell(out, into);
+}
+
+
+//
+// The fast path for a routine with a fixed number of arguments.  All of the
+// sizes and offsets were calculated by Alloc_Ffi_Action_For_Spec() when the
+// CIF was prepared, so the arguments can be converted directly into their
+// final positions with no series allocations.
+//
+static REB_R Dispatch_Fixed_Routine(REBFRM *f, REBRIN *rin)
+{
+    struct Reb_Ffi_Stats *stats = Ffi_Stats_If_On(rin);
+    REBI64 start_ns = stats ? Ffi_Nanoseconds() : 0;
+
+    const struct Reb_Routine_Layout *layout = RIN_LAYOUT(rin);
+    REBLEN num_args = layout->num_args;
+    assert(num_args == RIN_NUM_FIXED_ARGS(rin));
+
+    union {  // union members are just there to force worst-case alignment
+        REBYTE bytes[FFI_STACK_STORE_SIZE];
+        int64_t i64;
+        double d;
+        long double ld;
+        void *p;
+    } stack_store;
+
+    void *stack_args[FFI_STACK_ARGS_MAX];
+
+    REBARR *texts = RIN_TEXT_PARAMS(rin);
+
+    REBLEN store_size = layout->store_size;
+    if (texts)
+        store_size += Text_Params_Size(f, texts);
+
+    REBYTE *store;
+    if (store_size <= FFI_STACK_STORE_SIZE)
+        store = stack_store.bytes;
+    else {
+        store = Try_Claim_Store_Arena(f, store_size);
+        if (store == nullptr)
+            store = rebAllocN(REBYTE, store_size);  // freed on fail
+    }
+
+    void **args;
+    if (num_args <= FFI_STACK_ARGS_MAX)
+        args = stack_args;
+    else
+        args = rebAllocN(void*, num_args);  // freed automatically on fail
+
+    // Gather the parameters from the frame.  They are known to be of correct
+    // general types (they were checked by Eval_Core for the call) but a
+    // STRUCT! might not be compatible with the type of STRUCT! in the
+    // parameter specification.  They might also be out of range, e.g. a
+    // too-large or negative INTEGER! passed to a uint8.  Could fail() here.
+    //
+    REBARR *outs = RIN_OUT_PARAMS(rin);
+    const RELVAL *out_item = outs ? ARR_HEAD(outs) : nullptr;
+    REBYTE *pointee = store + layout->out_offset;
+
+    REBLEN i;
+    for (i = 0; i < num_args; ++i) {
+        args[i] = store + layout->arg_offsets[i];
+
+        if (out_item and cast(REBLEN, VAL_INT32(out_item)) == i) {
+            Out_Param_To_Ffi(
+                args[i],
+                pointee,
+                out_item,
+                FRM_ARG(f, i + 1),  // 1-based
+                ACT_KEY(FRM_PHASE(f), i + 1)  // 1-based
+            );
+            pointee += FFI_OUT_SLOT_SIZE;
+            out_item += 3;
+            if (out_item == ARR_TAIL(outs))
+                out_item = nullptr;
+            continue;
+        }
+
+        arg_to_ffi(
+            nullptr,  // no store, we are writing to a known destination
+            args[i],  // destination pointer
+            FRM_ARG(f, i + 1),  // 1-based
+            RIN_ARG_SCHEMA(rin, i),  // 0-based
+            ACT_KEY(FRM_PHASE(f), i + 1)  // 1-based
+        );
+    }
+
+    if (texts)
+        Text_Params_To_Ffi(f, texts, args, store + layout->store_size);
+
+    void *ret;
+    if (IS_BLANK(RIN_RET_SCHEMA(rin)))
+        ret = nullptr;
+    else
+        ret = store + layout->ret_offset;
+
+    // THE ACTUAL FFI CALL
+    //
+    // Note that any callbacks which run Rebol code during the course of
+    // calling this arbitrary C code are not allowed to propagate failures
+    // out of the callback--they'll panic and crash the interpreter, since
+    // they don't know what to do otherwise.  See MAKE-CALLBACK/FALLBACK for
+    // some mitigation of this problem.
+    //
+    REBI64 call_ns = stats ? Ffi_Nanoseconds() : 0;
+
+    enum Reb_Thunk_Kind thunk = RIN_THUNK(rin);
+    if (thunk != FFI_THUNK_NONE)
+        Call_Thunk(rin, thunk, ret, args);
+    else
+        ffi_call(
+            RIN_CIF(rin),
+            RIN_CFUNC(rin),
+            ret,
+            (num_args == 0) ? nullptr : args
+        );
+
+    REBI64 convert_ns = stats ? Ffi_Nanoseconds() : 0;
+
+    REBVAL *into = VAL_LOGIC(RIN_AT(rin, IDX_ROUTINE_HAS_INTO))
+        ? FRM_ARG(f, num_args + 1)  // 1-based, after the C arguments
+        : nullptr;
+
+    REBVAL *text_return = RIN_AT(rin, IDX_ROUTINE_TEXT_RETURN);
+    if (ret == nullptr)
+        Init_Nulled(f->out);
+    else if (into and not IS_BLANK(into))
+        Struct_Return_Into(f->out, into, RIN_RET_SCHEMA(rin), ret);
+    else if (not IS_BLANK(text_return))
+        Text_Return_To_Rebol(
+            f->out,
+            ret,
+            VAL_INT32(text_return),
+            RIN_AT(rin, IDX_ROUTINE_TEXT_FREE)
+        );
+    else
+        ffi_to_rebol(f->out, RIN_RET_SCHEMA(rin), ret);
+
+    if (outs)
+        Init_Out_Params_Result(
+            f->out,
+            outs,
+            store + layout->out_offset,
+            ret != nullptr
+        );
+
+    if (stats) {
+        ++stats->calls;
+        stats->marshal_ns += call_ns - start_ns;
+        stats->call_ns += convert_ns - call_ns;
+        stats->convert_ns += Ffi_Nanoseconds() - convert_ns;
+        stats->store_bytes += store_size;
+    }
+
+    if (args != stack_args)
+        rebFree(args);
+
+    if (store == Store_Arena)
+        Store_Arena_Owner = nullptr;
+    else if (store != stack_store.bytes)
+        rebFree(store);
+
+    // Note: cannot "throw" a Rebol value across an FFI boundary.
+
+    return f->out;
+}
+
+
+//
+// A variadic argument's type block can be used as part of a cache key if it
+// is just a word for a basic FFI type, e.g. `[int32]`.  Returns SYM_0 if not.
+//
+static SYMID Cacheable_Variadic_Sym(const RELVAL *blk)
+{
+    if (not IS_BLOCK(blk) or VAL_LEN_AT(blk) != 1)
+        return SYM_0;
+
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, blk);
+    if (not IS_WORD(item))
+        return SYM_0;
+
+    SYMID sym = VAL_WORD_ID(item);
+    if (sym == SYM_0 or Get_FFType_For_Sym(sym) == nullptr)
+        return SYM_0;  // includes VOID, which isn't legal as an argument
+
+    return sym;
+}
+
+static struct Reb_Cif_Cache_Entry *Find_Cif_Cache_Entry(
+    struct Reb_Cif_Cache *cache,
+    const SYMID *syms,
+    REBLEN num_variable
+){
+    REBLEN n;
+    for (n = 0; n < FFI_CIF_CACHE_SIZE; ++n) {
+        struct Reb_Cif_Cache_Entry *entry = &cache->entries[n];
+        if (entry->args_fftypes == nullptr)
+            continue;  // unused
+        if (entry->num_variable != num_variable)
+            continue;
+        if (0 != memcmp(entry->syms, syms, sizeof(SYMID) * num_variable))
+            continue;
+
+        entry->last_used = ++cache->tick;
+        return entry;
+    }
+    return nullptr;
+}
+
+static void Release_Cif_Cache_Entry(
+    struct Reb_Cif_Cache_Entry *entry,
+    REBLEN num_args  // fixed plus variable (cif.nargs, if prep succeeded)
+){
+    assert(entry->args_fftypes != nullptr);
+    FREE_N(ffi_type*, num_args + 1, entry->args_fftypes);
+    entry->args_fftypes = nullptr;
+}
+
+// Gives back an unused entry, evicting the least recently used one if the
+// cache is full.
+//
+static struct Reb_Cif_Cache_Entry *Claim_Cif_Cache_Entry(
+    struct Reb_Cif_Cache *cache
+){
+    struct Reb_Cif_Cache_Entry *lru = &cache->entries[0];
+
+    REBLEN n;
+    for (n = 0; n < FFI_CIF_CACHE_SIZE; ++n) {
+        struct Reb_Cif_Cache_Entry *entry = &cache->entries[n];
+        if (entry->args_fftypes == nullptr)
+            return entry;
+        if (entry->last_used < lru->last_used)
+            lru = entry;
+    }
+
+    Release_Cif_Cache_Entry(lru, lru->cif.nargs);
+    return lru;
+}
+
+
+//
+//  Routine_Dispatcher: C
+//
+REB_R Routine_Dispatcher(REBFRM *f)
+{
+    REBRIN *rin = ACT_DETAILS(FRM_PHASE(f));
+
+    if (RIN_IS_CALLBACK(rin) or RIN_LIB(rin) == nullptr) {
+        //
+        // lib is nullptr when routine is constructed from address directly,
+        // so there's nothing to track whether that gets loaded or unloaded
+    }
+    else {
+        if (IS_LIB_CLOSED(RIN_LIB(rin)))
+            fail (Error_Bad_Library_Raw());
+
+        Ensure_Routine_Bound(rin);
+    }
+
+    if (not RIN_IS_VARIADIC(rin))
+        return Dispatch_Fixed_Routine(f, rin);
+
+    struct Reb_Ffi_Stats *stats = Ffi_Stats_If_On(rin);
+
+    REBLEN num_fixed = RIN_NUM_FIXED_ARGS(rin);
+
+    REBDSP dsp_orig = DSP; // variadic args pushed to stack, so save base ptr
+
+    // The function specification should have one extra parameter for
+    // the variadic source ("...")
+    //
+    assert(ACT_NUM_PARAMS(FRM_PHASE(f)) == num_fixed + 1);
+
+    REBVAL *vararg = FRM_ARG(f, num_fixed + 1); // 1-based
+    assert(IS_VARARGS(vararg) and FRM_BINDING(f) == UNBOUND);
+
+    // Evaluate the VARARGS! feed of values to the data stack.  This way
+    // they will be available to be counted, to know how big to make the
+    // FFI argument series.
+    //
+    do {
+        if (Do_Vararg_Op_Maybe_End_Throws(
+            f->out,
+            VARARG_OP_TAKE,
+            vararg
+        )){
+            return R_THROWN;
+        }
+
+        if (IS_END(f->out))
+            break;
+
+        Copy_Cell(DS_PUSH(), f->out);
+        SET_END(f->out); // expected by Do_Vararg_Op
+    } while (true);
+
+    // !!! The Atronix va_list interface required a type to be specified
+    // for each argument--achieving what you would get if you used a
+    // C cast on each variadic argument.  Such as:
+    //
+    //     printf reduce ["%d, %f" 10 + 20 [int32] 12.34 [float]]
+    //
+    // While this provides generality, it may be useful to use defaulting
+    // like C's where integer types default to `int` and floating point
+    // types default to `double`.  In the VARARGS!-based syntax it could
+    // offer several possibilities:
+    //
+    //     (printf "%d, %f" (10 + 20) 12.34)
+    //     (printf "%d, %f" [int32 10 + 20] 12.34)
+    //     (printf "%d, %f" [int32] 10 + 20 [float] 12.34)
+    //
+    // For the moment, this is following the idea that there must be
+    // pairings of values and then blocks (though the values are evaluated
+    // expressions).
+    //
+    if ((DSP - dsp_orig) % 2 != 0)
+        fail ("Variadic FFI functions must alternate blocks and values");
+
+    REBLEN num_variable = (DSP - dsp_orig) / 2;
+
+    REBLEN num_args = num_fixed + num_variable;
+
+    // The FFI arguments are passed by void*.  Those void pointers point to
+    // transformations of the Rebol arguments into ranges of memory of
+    // various sizes.  This is the backing store for those arguments, which
+    // is appended to for each one.  The memory is freed after the call.
+    //
+    // The offsets array has one element for each argument.  These point at
+    // indexes of where each FFI variable resides.  Offsets are used instead
+    // of pointers in case the store has to be resized, which may move the
+    // base of the series.  Hence the offsets must be mutated into pointers
+    // at the last minute before the FFI call.
+    //
+    // (Non-variadic routines avoid all of this with a precalculated layout,
+    // see Dispatch_Fixed_Routine().)
+    //
+    REBI64 start_ns = stats ? Ffi_Nanoseconds() : 0;  // after VARARGS! taken
+
+    REBBIN *store = Make_Binary(1);
+
+    void *ret_offset;
+    if (not IS_BLANK(RIN_RET_SCHEMA(rin))) {
+        ret_offset = cast(void*, arg_to_ffi(
+            store, // ffi-converted arg appended here
+            nullptr, // dest pointer must be nullptr if store is non-nullptr
+            nullptr, // arg: none (we're only making space--leave uninitialized)
+            RIN_RET_SCHEMA(rin),
+            nullptr // param: none (it's a return value/output)
+        ));
+    }
+    else {
+        // Shouldn't be used (assigned to nullptr later) but avoid maybe
+        // uninitialized warning.
+        //
+        ret_offset = cast(void*, cast(uintptr_t, 0xDECAFBAD));
+    }
+
+    REBSER *arg_offsets;
+    if (num_args == 0)
+        arg_offsets = nullptr;  // don't waste time with the alloc + free
+    else
+        arg_offsets = Make_Series(num_args, FLAVOR_POINTER);
+
+    // First gather the fixed parameters from the frame.  They are known to
+    // be of correct general types (they were checked by Eval_Core for the call)
+    // but a STRUCT! might not be compatible with the type of STRUCT! in
+    // the parameter specification.  They might also be out of range, e.g.
+    // a too-large or negative INTEGER! passed to a uint8.  Could fail() here.
+    //
+  blockscope {
+    REBLEN i = 0;
+    for (; i < num_fixed; ++i) {
+        uintptr_t offset = arg_to_ffi(
+            store,  // ffi-converted arg appended here
+            nullptr,  // dest pointer must be nullptr if store is non-null
+            FRM_ARG(f, i + 1),  // 1-based
+            RIN_ARG_SCHEMA(rin, i),  // 0-based
+            ACT_KEY(FRM_PHASE(f), i + 1)  // 1-based
+        );
+
+        // We will convert the offset to a pointer later
+        //
+        *SER_AT(void*, arg_offsets, i) = cast(void*, offset);
+    }
+  }
+
+    // A variadic routine requires a CIF that matches the number and types of
+    // arguments for that specific call.  If the variadic types are all plain
+    // words (as in `printf "%d" 10 [int32]`) then a CIF prepared by an earlier
+    // call with the same sequence of types can be reused.
+    //
+    assert(IS_BLANK(RIN_AT(rin, IDX_ROUTINE_CIF)));
+
+    struct Reb_Cif_Cache *cache = RIN_CIF_CACHE(rin);
+
+    SYMID syms[FFI_CIF_CACHE_MAX_ARGS];
+    bool cacheable = (num_variable <= FFI_CIF_CACHE_MAX_ARGS);
+
+  blockscope {
+    REBLEN n;
+    REBDSP dsp = dsp_orig + 1;
+    for (n = 0; cacheable and n < num_variable; ++n, dsp += 2) {
+        syms[n] = Cacheable_Variadic_Sym(DS_AT(dsp + 1));
+        if (syms[n] == SYM_0)
+            cacheable = false;
+    }
+  }
+
+    struct Reb_Cif_Cache_Entry *hit;
+    if (cacheable)
+        hit = Find_Cif_Cache_Entry(cache, syms, num_variable);
+    else
+        hit = nullptr;
+
+    ffi_cif *cif;  // pre-made if cache hit, prepped for this call otherwise
+    ffi_type **args_fftypes;
+
+    if (hit) {
+        ++cache->hits;
+        cif = &hit->cif;
+        args_fftypes = hit->args_fftypes;
+    }
+    else {
+        ++cache->misses;
+        if (stats)
+            ++stats->cif_preps;
+        cif = nullptr;  // can't prep until all the argument types are known
+
+        // CIF creation requires a C array of argument descriptions that is
+        // contiguous across both the fixed and variadic parts.  Start by
+        // filling in the ffi_type*s for all the fixed args.
+        //
+        args_fftypes = rebAllocN(ffi_type*, num_args + 1);  // never size 0
+
+        REBLEN i;
+        for (i = 0; i < num_fixed; ++i)
+            args_fftypes[i] = SCHEMA_FFTYPE(RIN_ARG_SCHEMA(rin, i));
+    }
+
+  blockscope {
+    DECLARE_LOCAL (schema);
+    DECLARE_LOCAL (param);
+
+    REBLEN i = num_fixed;
+    REBDSP dsp;
+    for (dsp = dsp_orig + 1; i < num_args; dsp += 2, ++i) {
+        if (hit) {
+            //
+            // The type word was the cache key, and it was validated by the
+            // Schema_From_Block_May_Fail() of the call that missed.
+            //
+            Init_Word(schema, Canon(hit->syms[i - num_fixed]));
+        }
+        else {
+            // This param is used with the variadic type spec, and is
+            // initialized as it would be for an ordinary FFI argument.  This
+            // means its allowed type flags are set, which is not really
+            // necessary.  Whatever symbol name is used here will be seen
+            // in error reports.
+            //
+            Schema_From_Block_May_Fail(
+                schema,
+                param, // sets type bits in param
+                DS_AT(dsp + 1), // will error if this is not a block
+                Canon(SYM_ELLIPSIS)
+            );
+
+            args_fftypes[i] = SCHEMA_FFTYPE(schema);
+        }
+
+        *SER_AT(void*, arg_offsets, i) = cast(void*, arg_to_ffi(
+            store,  // data appended to store
+            nullptr,  // dest pointer must be null if store is non-null
+            DS_AT(dsp),  // arg
+            schema,
+            nullptr  // REVIEW: need key for error messages
+        ));
+    }
+  }
+
+    DS_DROP_TO(dsp_orig);  // done w/args (converted to bytes in `store`)
+
+    if (not hit) {
+        struct Reb_Cif_Cache_Entry *entry;
+        if (not cacheable) {
+            entry = nullptr;
+            cif = rebAlloc(ffi_cif);
+        }
+        else {
+            // Move the argument types into memory owned by the cache, which
+            // must live as long as the CIF that is prepped from them.
+            //
+            entry = Claim_Cif_Cache_Entry(cache);
+            entry->args_fftypes = TRY_ALLOC_N(ffi_type*, num_args + 1);
+            if (entry->args_fftypes == nullptr)
+                fail (Error_No_Memory(sizeof(ffi_type*) * (num_args + 1)));
+            memcpy(
+                entry->args_fftypes,
+                args_fftypes,
+                sizeof(ffi_type*) * num_args
+            );
+            rebFree(args_fftypes);
+            args_fftypes = entry->args_fftypes;
+
+            entry->num_variable = num_variable;
+            memcpy(entry->syms, syms, sizeof(SYMID) * num_variable);
+            entry->last_used = ++cache->tick;
+            cif = &entry->cif;
+        }
+
+        ffi_status status = ffi_prep_cif_var(  // _var-iadic prep_cif version
+            cif,
+            RIN_ABI(rin),
+            num_fixed,  // just fixed
+            num_args,  // fixed plus variable
+            IS_BLANK(RIN_RET_SCHEMA(rin))
+                ? &ffi_type_void
+                : SCHEMA_FFTYPE(RIN_RET_SCHEMA(rin)),  // return FFI type
+            args_fftypes  // arguments FFI types
+        );
+
+        if (status != FFI_OK) {
+            if (entry)
+                Release_Cif_Cache_Entry(entry, num_args);
+            else {
+                rebFree(cif);  // would free automatically on fail
+                rebFree(args_fftypes);  // would free automatically on fail
+            }
+            fail ("FFI: Couldn't prep CIF_VAR");
+        }
     }
 
     // Now that all the additions to store have been made, we want to change
@@ -851,64 +1863,785 @@ REB_R Routine_Dispatcher(REBFRM *f)
         ret_offset = SER_DATA(store) + cast(uintptr_t, ret_offset);
 
     REBLEN i;
-    for (i = 0; i < num_args; ++i) {
-        uintptr_t off = cast(uintptr_t, *SER_AT(void*, arg_offsets, i));
-        assert(off == 0 or off < BIN_LEN(store));
-        *SER_AT(void*, arg_offsets, i) = BIN_AT(store, off);
+    for (i = 0; i < num_args; ++i) {
+        uintptr_t off = cast(uintptr_t, *SER_AT(void*, arg_offsets, i));
+        assert(off == 0 or off < BIN_LEN(store));
+        *SER_AT(void*, arg_offsets, i) = BIN_AT(store, off);
+    }
+  }
+
+    // THE ACTUAL FFI CALL (see notes in Dispatch_Fixed_Routine())
+    //
+    // Note that the "offsets" are now direct pointers.
+    //
+    REBI64 call_ns = stats ? Ffi_Nanoseconds() : 0;
+
+    ffi_call(
+        cif,
+        RIN_CFUNC(rin),
+        ret_offset,  // actually a real pointer now (no longer an offset)
+        (num_args == 0)
+            ? nullptr
+            : SER_HEAD(void*, arg_offsets)  // also real pointers now
+    );
+
+    REBI64 convert_ns = stats ? Ffi_Nanoseconds() : 0;
+
+    if (IS_BLANK(RIN_RET_SCHEMA(rin)))
+        Init_Nulled(f->out);
+    else
+        ffi_to_rebol(f->out, RIN_RET_SCHEMA(rin), ret_offset);
+
+    if (stats) {
+        ++stats->calls;
+        stats->marshal_ns += call_ns - start_ns;  // includes any CIF prep
+        stats->call_ns += convert_ns - call_ns;
+        stats->convert_ns += Ffi_Nanoseconds() - convert_ns;
+        stats->store_bytes += BIN_LEN(store);
+    }
+
+    if (num_args != 0)
+        Free_Unmanaged_Series(arg_offsets);
+
+    Free_Unmanaged_Series(store);
+
+    if (not cacheable) {
+        rebFree(cif);
+        rebFree(args_fftypes);
+    }
+
+    // Note: cannot "throw" a Rebol value across an FFI boundary.
+
+    return f->out;
+}
+
+
+struct Reb_Closure_Pool Closure_Pool = { nullptr, 0, 0, 0, 0 };
+
+
+//
+//  Claim_Closure_Slot: C
+//
+// Get a closure for a new callback, from the pool if there's one idle.  The
+// caller preps it with ffi_prep_closure_loc() either way.
+//
+struct Reb_Closure_Slot *Claim_Closure_Slot(void)
+{
+    struct Reb_Closure_Slot *slot = Closure_Pool.free;
+    if (slot) {
+        Closure_Pool.free = slot->next_free;
+        --Closure_Pool.num_free;
+        ++Closure_Pool.reused;
+    }
+    else {
+        void *thunk;  // actually CFUNC (FFI uses void*, may not be same size!)
+        ffi_closure *closure = cast(ffi_closure*, ffi_closure_alloc(
+            sizeof(ffi_closure), &thunk
+        ));
+        if (closure == nullptr)
+            fail ("FFI: Couldn't allocate closure");
+
+        slot = TRY_ALLOC(struct Reb_Closure_Slot);
+        if (slot == nullptr) {
+            ffi_closure_free(closure);
+            fail (Error_No_Memory(sizeof(struct Reb_Closure_Slot)));
+        }
+        slot->closure = closure;
+        slot->thunk = thunk;
+        ++Closure_Pool.created;
+    }
+
+    slot->next_free = nullptr;
+    ++Closure_Pool.num_live;
+    return slot;
+}
+
+
+static void Free_Closure_Slot(struct Reb_Closure_Slot *slot) {
+    ffi_closure_free(slot->closure);
+    FREE(struct Reb_Closure_Slot, slot);
+}
+
+
+//
+// cleanup_ffi_closure: C
+//
+// The GC-able HANDLE! used by callbacks contains a Reb_Closure_Slot that
+// needs to be given back when the handle references go away (really only one
+// reference is likely--in the ACT_BODY of the callback, but still this is
+// how the GC gets hooked in Ren-C)
+//
+void cleanup_ffi_closure(const REBVAL *v) {
+    struct Reb_Closure_Slot *slot = VAL_HANDLE_POINTER(
+        struct Reb_Closure_Slot, v
+    );
+    --Closure_Pool.num_live;
+
+    if (Closure_Pool.num_free >= FFI_CLOSURE_POOL_MAX) {
+        Free_Closure_Slot(slot);
+        return;
+    }
+
+    slot->next_free = Closure_Pool.free;
+    Closure_Pool.free = slot;
+    ++Closure_Pool.num_free;
+}
+
+
+//
+//  Shutdown_Closure_Pool: C
+//
+// Frees the idle closures.  (Live ones are freed by GC of their callbacks.)
+//
+void Shutdown_Closure_Pool(void)
+{
+    while (Closure_Pool.free) {
+        struct Reb_Closure_Slot *slot = Closure_Pool.free;
+        Closure_Pool.free = slot->next_free;
+        Free_Closure_Slot(slot);
+    }
+    Closure_Pool.num_free = 0;
+}
+
+
+// Where CALL-MANY gets an argument from on each row.
+//
+struct Reb_Call_Many_Column {
+    const REBYTE *base;  // nullptr if the argument is the same on every row
+    REBSIZ size;  // bytes per element
+    bool aligned;  // aligned elements are passed in place instead of copied
+};
+
+// What every row of a CALL-MANY has in common.  Nothing here is changed by
+// making the calls, so parallel slices can share it.
+//
+struct Reb_Call_Many_Batch {
+    ffi_cif *cif;
+    CFUNC *cfunc;
+    const struct Reb_Routine_Layout *layout;
+    const struct Reb_Call_Many_Column *cols;
+    REBYTE *dest;  // start of the result VECTOR!'s data, nullptr if void
+};
+
+
+//
+// Make the calls for rows `first` up to (but not including) `end`.  The
+// `store` must have been filled in with the scalar arguments, and `args`
+// must be `num_args` long (its entries are overwritten).
+//
+// This may run on a worker thread, so it must not touch any REBVAL.
+//
+static void Call_Many_Rows(
+    const struct Reb_Call_Many_Batch *b,
+    REBYTE *store,
+    void **args,
+    REBLEN first,
+    REBLEN end
+){
+    const struct Reb_Routine_Layout *layout = b->layout;
+    REBLEN num_args = layout->num_args;
+    ffi_type *rtype = b->cif->rtype;
+
+    REBLEN i;
+    for (i = 0; i < num_args; ++i)
+        args[i] = store + layout->arg_offsets[i];
+
+    void *ret = b->dest ? store + layout->ret_offset : nullptr;
+
+    REBLEN row;
+    for (row = first; row < end; ++row) {
+        for (i = 0; i < num_args; ++i) {
+            const struct Reb_Call_Many_Column *col = &b->cols[i];
+            if (col->base == nullptr)
+                continue;  // scalar, already sitting in the store
+
+            const REBYTE *elem = col->base + row * col->size;
+            if (col->aligned)
+                args[i] = m_cast(REBYTE*, elem);  // libffi only reads it
+            else
+                memcpy(store + layout->arg_offsets[i], elem, col->size);
+        }
+
+        ffi_call(b->cif, b->cfunc, ret, (num_args == 0) ? nullptr : args);
+
+        if (b->dest)
+            Narrow_Ffi_Return(b->dest + row * rtype->size, ret, rtype);
+    }
+}
+
+
+// CALL-MANY/PARALLEL gives each worker a contiguous run of rows, with its
+// own copy of the store (so the argument slots it writes are its own) and
+// its own slice of the result VECTOR!.
+//
+#define FFI_PARALLEL_MIN_ROWS 256  // fewer rows per worker isn't worth it
+
+struct Reb_Call_Many_Slice {
+    struct Reb_Ffi_Job job;  // must be first
+    const struct Reb_Call_Many_Batch *batch;
+    REBYTE *store;
+    void **args;
+    REBLEN first;
+    REBLEN end;
+};
+
+static void Run_Call_Many_Slice(struct Reb_Ffi_Job *job)  // on a worker
+{
+    struct Reb_Call_Many_Slice *slice = cast(struct Reb_Call_Many_Slice*, job);
+    Call_Many_Rows(
+        slice->batch, slice->store, slice->args, slice->first, slice->end
+    );
+}
+
+static void Call_Many_Rows_Parallel(
+    const struct Reb_Call_Many_Batch *b,
+    const REBYTE *store,  // scalar arguments filled in, copied per slice
+    REBLEN rows
+){
+    REBLEN num_slices = rows / FFI_PARALLEL_MIN_ROWS;
+    if (num_slices > Num_Ffi_Workers(FFI_POOL_COMPUTE))
+        num_slices = Num_Ffi_Workers(FFI_POOL_COMPUTE);
+    if (num_slices < 2) {  // not enough rows to be worth handing off
+        void **args = rebAllocN(void*, b->layout->num_args + 1);
+        Call_Many_Rows(b, m_cast(REBYTE*, store), args, 0, rows);
+        rebFree(args);
+        return;
+    }
+
+    REBLEN store_size = b->layout->store_size;
+    REBLEN num_args = b->layout->num_args;
+
+    struct Reb_Call_Many_Slice *slices = rebAllocN(
+        struct Reb_Call_Many_Slice, num_slices
+    );
+
+    // Nothing between submitting and waiting can fail(), which would free
+    // the rebAlloc()'d memory out from under the workers.
+    //
+    REBLEN per_slice = (rows + num_slices - 1) / num_slices;
+    REBLEN n;
+    for (n = 0; n < num_slices; ++n) {
+        struct Reb_Call_Many_Slice *slice = &slices[n];
+        slice->job.run = &Run_Call_Many_Slice;
+        slice->batch = b;
+        slice->store = rebAllocN(REBYTE, store_size);
+        memcpy(slice->store, store, store_size);
+        slice->args = rebAllocN(void*, num_args + 1);
+        slice->first = n * per_slice;
+        slice->end = slice->first + per_slice;
+        if (slice->end > rows)
+            slice->end = rows;
+    }
+
+    for (n = 0; n < num_slices; ++n)
+        Submit_Ffi_Job(&slices[n].job, FFI_POOL_COMPUTE);
+
+    for (n = 0; n < num_slices; ++n) {
+        Wait_Ffi_Job(&slices[n].job);
+        rebFree(slices[n].args);
+        rebFree(slices[n].store);
+    }
+
+    rebFree(slices);
+}
+
+
+//
+//  Call_Routine_Many: C
+//
+// Implementation of CALL-MANY (see notes on the native in %mod-ffi.c).
+//
+// All of the per-call work of Routine_Dispatcher() that doesn't depend on the
+// argument values themselves is done once up front: the library check, the
+// type checks of the columns, and the conversion of any scalar arguments.
+// What's left in the loop is just pointing libffi at the next element of
+// each column and narrowing the return value into the result VECTOR!.
+//
+// !!! The column data is used in place.  If the C function calls back into
+// Rebol code that resizes one of the columns, that memory will be stale.
+//
+// With `parallel`, the rows are split across the worker threads.  That is
+// only allowed for routines whose spec says they are <reentrant>.
+//
+void Call_Routine_Many(
+    REBVAL *out,
+    const REBVAL *routine,
+    const REBVAL *columns,  // already reduced, one item per argument
+    option(const REBVAL*) into,
+    bool parallel
+){
+    assert(IS_ACTION_RIN(routine));
+    REBRIN *rin = ACT_DETAILS(VAL_ACTION(routine));
+
+    if (RIN_IS_VARIADIC(rin))
+        fail ("CALL-MANY can't be used with variadic routines");
+
+    if (RIN_HAS_CONVERSIONS(rin))
+        fail ("CALL-MANY can't do the out or text parameters of a routine");
+
+    if (parallel and not RIN_IS_REENTRANT(rin))
+        fail ("CALL-MANY/PARALLEL needs a routine marked <reentrant>");
+
+    if (RIN_IS_CALLBACK(rin) or RIN_LIB(rin) == nullptr) {
+        // no LIBRARY! to check (see Routine_Dispatcher())
+    }
+    else {
+        if (IS_LIB_CLOSED(RIN_LIB(rin)))
+            fail (Error_Bad_Library_Raw());
+
+        Ensure_Routine_Bound(rin);
+    }
+
+    const struct Reb_Routine_Layout *layout = RIN_LAYOUT(rin);
+    REBLEN num_args = layout->num_args;
+
+    if (VAL_LEN_AT(columns) != num_args)
+        fail ("CALL-MANY needs one column (or scalar) per routine argument");
+
+    REBYTE *store = rebAllocN(REBYTE, layout->store_size);
+    void **args = rebAllocN(void*, num_args + 1);  // never size 0
+    struct Reb_Call_Many_Column *cols = rebAllocN(
+        struct Reb_Call_Many_Column, num_args + 1
+    );
+
+    bool have_rows = false;
+    REBLEN rows = 0;
+
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, columns);
+
+    REBLEN i;
+    for (i = 0; i < num_args; ++i, ++item) {
+        const REBVAL *arg = SPECIFIC(item);
+        const REBVAL *schema = RIN_ARG_SCHEMA(rin, i);
+        struct Reb_Call_Many_Column *col = &cols[i];
+        args[i] = store + layout->arg_offsets[i];
+
+        bool scalar_type = IS_WORD(schema)
+            and VAL_WORD_ID(schema) != SYM_REBVAL;
+
+        // A BINARY! (or TEXT!) for a pointer is passed as the address of its
+        // data, as in an ordinary call--not read as a column of addresses.
+        //
+        bool pointer_type = IS_WORD(schema)
+            and VAL_WORD_ID(schema) == SYM_POINTER;
+
+        REBLEN len;
+        if (scalar_type and IS_VECTOR(arg)) {
+            if (not Vector_Matches_FFType(arg, SCHEMA_FFTYPE(schema)))
+                fail ("CALL-MANY column VECTOR! doesn't match argument type");
+
+            col->base = VAL_VECTOR_HEAD(arg)
+                + VAL_VECTOR_INDEX(arg) * VAL_VECTOR_WIDE(arg);
+            len = VAL_VECTOR_LEN_AT(arg);
+        }
+        else if (scalar_type and not pointer_type and IS_BINARY(arg)) {
+            REBSIZ size;
+            col->base = VAL_BYTES_AT(&size, arg);
+            if (size % SCHEMA_FFTYPE(schema)->size != 0)
+                fail ("CALL-MANY column BINARY! not a multiple of type size");
+
+            len = size / SCHEMA_FFTYPE(schema)->size;
+        }
+        else {
+            // Same value for every row, so convert it just this once.
+            //
+            arg_to_ffi(
+                nullptr,  // no store, we are writing to a known destination
+                args[i],  // destination pointer
+                arg,
+                schema,
+                ACT_KEY(VAL_ACTION(routine), i + 1)  // 1-based
+            );
+            col->base = nullptr;
+            continue;
+        }
+
+        if (have_rows and len != rows)
+            fail ("CALL-MANY columns must all be the same length");
+        rows = len;
+        have_rows = true;
+
+        col->size = SCHEMA_FFTYPE(schema)->size;
+        col->aligned = (
+            cast(uintptr_t, col->base) % SCHEMA_FFTYPE(schema)->alignment == 0
+        );
     }
-  }
 
-    // THE ACTUAL FFI CALL
-    //
-    // Note that the "offsets" are now direct pointers.  Also note that
-    // any callbacks which run Rebol code during the course of calling this
-    // arbitrary C code are not allowed to propagate failures out of the
-    // callback--they'll panic and crash the interpreter, since they don't
-    // know what to do otherwise.  See MAKE-CALLBACK/FALLBACK for some
-    // mitigation of this problem.
+    ffi_type *rtype = RIN_CIF(rin)->rtype;
+
+    REBYTE *dest;
+
+    if (IS_BLANK(RIN_RET_SCHEMA(rin))) {
+        if (into)
+            fail ("CALL-MANY can't use /INTO with a routine returning void");
+
+        dest = nullptr;
+        Init_Nulled(out);
+    }
+    else {
+        const REBVAL *ret_schema = RIN_RET_SCHEMA(rin);
+        if (not IS_WORD(ret_schema) or VAL_WORD_ID(ret_schema) == SYM_REBVAL)
+            fail ("CALL-MANY only supports routines with scalar return types");
+
+        if (into) {
+            const REBVAL *v = unwrap(into);
+            if (not Vector_Matches_FFType(v, rtype))
+                fail ("CALL-MANY /INTO VECTOR! doesn't match return type");
+
+            if (not have_rows) {
+                rows = VAL_VECTOR_LEN_AT(v);
+                have_rows = true;
+            }
+            else if (VAL_VECTOR_LEN_AT(v) < rows)
+                fail ("CALL-MANY /INTO VECTOR! is shorter than the columns");
+
+            Copy_Cell(out, v);
+        }
+        else {
+            if (not have_rows)
+                fail ("CALL-MANY needs a column or /INTO for how many calls");
+
+            REBVAL *vector = Make_Vector_For_FFType(rtype, rows);
+            Copy_Cell(out, vector);
+            rebRelease(vector);
+        }
+
+        dest = VAL_VECTOR_HEAD(out) + VAL_VECTOR_INDEX(out) * rtype->size;
+    }
+
+    if (not have_rows)  // void routine and nothing but scalars
+        fail ("CALL-MANY needs at least one column to know how many calls");
+
+    struct Reb_Call_Many_Batch batch;
+    batch.cif = RIN_CIF(rin);
+    batch.cfunc = RIN_CFUNC(rin);
+    batch.layout = layout;
+    batch.cols = cols;
+    batch.dest = dest;
+
+    if (parallel)
+        Call_Many_Rows_Parallel(&batch, store, rows);
+    else
+        Call_Many_Rows(&batch, store, args, 0, rows);
+
+    rebFree(cols);
+    rebFree(args);
+    rebFree(store);
+}
+
+
+//=//// ASYNCHRONOUS CALLS ////////////////////////////////////////////////=//
+//
+// CALL-ASYNC converts the arguments just like an ordinary call would, but
+// into a store of its own, and then has a worker thread do the ffi_call().
+// The caller gets a HANDLE! for the job which ASYNC-WAIT turns into the
+// result (converted on the interpreter thread, with ffi_to_rebol()).
+//
+// Pointer arguments only copy a pointer, so the values they came from are
+// kept alive by an API handle until the result is collected.  BINARY! and
+// TEXT! are also put on HOLD, since modifying them could move their data
+// out from under the C code.
+//
+// !!! Callbacks invoked by C code on a worker thread must be made with
+// WRAP-CALLBACK/FOREIGN.
+//
+
+struct Reb_Async_Call {
+    struct Reb_Ffi_Job job;  // must be first, the pool only knows about this
+
+    ffi_cif *cif;
+    CFUNC *cfunc;
+    REBLEN num_args;
+    REBLEN store_size;
+    REBYTE *store;
+    void **args;
+    void *ret;  // nullptr if void
+
+    // The routine and its arguments, or nullptr once collected.  After the
+    // HANDLE! is GC'd the call moves to the abandoned list (the list link
+    // is only used then), since releasing API handles can't be done by a
+    // GC cleanup function...and nor can this be freed if still running.
     //
+    REBVAL *pinned;
+    REBSER **held;  // series this call put on HOLD, `num_held` of them
+    REBLEN num_held;
+    struct Reb_Async_Call *next_abandoned;
+};
+
+static struct Reb_Async_Call *Abandoned_Async_Calls = nullptr;
+
+
+static void Run_Async_Call(struct Reb_Ffi_Job *job)  // on a worker thread
+{
+    struct Reb_Async_Call *call = cast(struct Reb_Async_Call*, job);
     ffi_call(
-        cif,
-        RIN_CFUNC(rin),
-        ret_offset,  // actually a real pointer now (no longer an offset)
-        (num_args == 0)
-            ? nullptr
-            : SER_HEAD(void*, arg_offsets)  // also real pointers now
+        call->cif,
+        call->cfunc,
+        call->ret,
+        (call->num_args == 0) ? nullptr : call->args
     );
+}
+
+
+static void Release_Async_Pins(struct Reb_Async_Call *call)
+{
+    REBLEN n;
+    for (n = 0; n < call->num_held; ++n)
+        CLEAR_SERIES_INFO(call->held[n], HOLD);
+
+    rebRelease(call->pinned);
+    call->pinned = nullptr;
+}
+
+
+static void Free_Async_Call(struct Reb_Async_Call *call)
+{
+    assert(call->pinned == nullptr);
+    FREE_N(REBSER*, call->num_args + 1, call->held);
+    FREE_N(void*, call->num_args + 1, call->args);
+    FREE_N(REBYTE, call->store_size + 1, call->store);
+    FREE(struct Reb_Async_Call, call);
+}
+
+
+static void cleanup_async_call(const REBVAL *v) {
+    struct Reb_Async_Call *call = VAL_HANDLE_POINTER(struct Reb_Async_Call, v);
+
+    if (call->pinned == nullptr) {  // result collected, so no longer running
+        Free_Async_Call(call);
+        return;
+    }
+
+    call->next_abandoned = Abandoned_Async_Calls;
+    Abandoned_Async_Calls = call;
+}
+
+
+//
+// Free any abandoned calls that have finished (or all of them, waiting on the
+// ones still running, if `wait` is true).
+//
+static void Reap_Abandoned_Async_Calls(bool wait)
+{
+    struct Reb_Async_Call **link = &Abandoned_Async_Calls;
+    while (*link) {
+        struct Reb_Async_Call *call = *link;
+        if (wait)
+            Wait_Ffi_Job(&call->job);
+        else if (not Is_Ffi_Job_Done(&call->job)) {
+            link = &call->next_abandoned;
+            continue;
+        }
+
+        *link = call->next_abandoned;
+        Release_Async_Pins(call);
+        Free_Async_Call(call);
+    }
+}
+
+
+//
+//  Call_Routine_Async: C
+//
+// Start a call to a non-variadic routine on a worker thread, putting a
+// HANDLE! for the job in `out`.  Arguments are given in a reduced BLOCK!.
+//
+void Call_Routine_Async(
+    REBVAL *out,
+    const REBVAL *routine,
+    const REBVAL *arguments  // already reduced, one item per argument
+){
+    assert(IS_ACTION_RIN(routine));
+    REBRIN *rin = ACT_DETAILS(VAL_ACTION(routine));
+
+    if (RIN_IS_VARIADIC(rin))
+        fail ("CALL-ASYNC can't be used with variadic routines");
+
+    if (RIN_HAS_CONVERSIONS(rin))
+        fail ("CALL-ASYNC can't do the out or text parameters of a routine");
+
+    if (RIN_IS_CALLBACK(rin))
+        fail ("CALL-ASYNC can't be used with callbacks");
+
+    if (RIN_LIB(rin) != nullptr) {
+        if (IS_LIB_CLOSED(RIN_LIB(rin)))
+            fail (Error_Bad_Library_Raw());
+
+        Ensure_Routine_Bound(rin);
+    }
+
+    Reap_Abandoned_Async_Calls(false);
+
+    const struct Reb_Routine_Layout *layout = RIN_LAYOUT(rin);
+    REBLEN num_args = layout->num_args;
+
+    if (VAL_LEN_AT(arguments) != num_args)
+        fail ("CALL-ASYNC needs exactly one value per routine argument");
+
+    // Convert into a temporary store first: arg_to_ffi() may fail, and the
+    // rebAlloc() memory is freed automatically if it does.
+    //
+    REBYTE *temp = rebAllocN(REBYTE, layout->store_size + 1);
+
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, arguments);
+
+    REBLEN i;
+    for (i = 0; i < num_args; ++i, ++item) {
+        arg_to_ffi(
+            nullptr,  // no store, we are writing to a known destination
+            temp + layout->arg_offsets[i],
+            SPECIFIC(item),
+            RIN_ARG_SCHEMA(rin, i),
+            ACT_KEY(VAL_ACTION(routine), i + 1)  // 1-based
+        );
+    }
+
+    struct Reb_Async_Call *call = TRY_ALLOC(struct Reb_Async_Call);
+    if (call == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Async_Call)));
+
+    call->store = TRY_ALLOC_N(REBYTE, layout->store_size + 1);
+    call->args = TRY_ALLOC_N(void*, num_args + 1);
+    call->held = TRY_ALLOC_N(REBSER*, num_args + 1);
+    if (
+        call->store == nullptr or call->args == nullptr
+        or call->held == nullptr
+    ){
+        if (call->store)
+            FREE_N(REBYTE, layout->store_size + 1, call->store);
+        if (call->args)
+            FREE_N(void*, num_args + 1, call->args);
+        if (call->held)
+            FREE_N(REBSER*, num_args + 1, call->held);
+        FREE(struct Reb_Async_Call, call);
+        fail (Error_No_Memory(layout->store_size + 1));
+    }
+
+    call->job.run = &Run_Async_Call;
+    call->cif = RIN_CIF(rin);
+    call->cfunc = RIN_CFUNC(rin);
+    call->num_args = num_args;
+    call->store_size = layout->store_size;
+    call->num_held = 0;
+    call->next_abandoned = nullptr;
+
+    memcpy(call->store, temp, layout->store_size);
+    rebFree(temp);
+
+    for (i = 0; i < num_args; ++i)
+        call->args[i] = call->store + layout->arg_offsets[i];
 
     if (IS_BLANK(RIN_RET_SCHEMA(rin)))
-        Init_Nulled(f->out);
+        call->ret = nullptr;
     else
-        ffi_to_rebol(f->out, RIN_RET_SCHEMA(rin), ret_offset);
+        call->ret = call->store + layout->ret_offset;
 
-    if (num_args != 0)
-        Free_Unmanaged_Series(arg_offsets);
+    REBARR *pins = Make_Array(1 + num_args);
+    Copy_Cell(ARR_HEAD(pins), routine);
 
-    Free_Unmanaged_Series(store);
+    item = VAL_ARRAY_AT(&tail, arguments);
+    for (i = 0; i < num_args; ++i, ++item) {
+        Derelativize(ARR_AT(pins, i + 1), item, VAL_SPECIFIER(arguments));
 
-    if (RIN_IS_VARIADIC(rin)) {
-        rebFree(cif);
-        rebFree(args_fftypes);
+        if (not IS_TEXT(item) and not IS_BINARY(item))
+            continue;
+
+        REBSER *s = m_cast(REBSER*, VAL_SERIES(item));
+        if (GET_SERIES_INFO(s, HOLD))
+            continue;  // already held (e.g. passed twice), not ours to clear
+
+        SET_SERIES_INFO(s, HOLD);
+        call->held[call->num_held++] = s;
     }
+    SET_SERIES_LEN(pins, 1 + num_args);
 
-    // Note: cannot "throw" a Rebol value across an FFI boundary.
+    call->pinned = Init_Block(Alloc_Value(), pins);
+    rebUnmanage(call->pinned);
 
-    return f->out;
+    Submit_Ffi_Job(&call->job, FFI_POOL_BLOCKING);
+
+    Init_Handle_Cdata_Managed(
+        out,
+        call,
+        sizeof(struct Reb_Async_Call),
+        &cleanup_async_call
+    );
+}
+
+
+static struct Reb_Async_Call *Async_Call_From_Handle(const REBVAL *job)
+{
+    // Only the cleaner tells a job's HANDLE! apart from any other without
+    // looking at what its pointer points to (which could be anything).
+    //
+    if (VAL_HANDLE_CLEANER(job) != &cleanup_async_call)
+        fail ("FFI: HANDLE! is not a job from CALL-ASYNC");
+
+    assert(VAL_HANDLE_LEN(job) == sizeof(struct Reb_Async_Call));
+    return VAL_HANDLE_POINTER(struct Reb_Async_Call, job);
 }
 
 
 //
-// cleanup_ffi_closure: C
+//  Is_Async_Call_Done: C
 //
-// The GC-able HANDLE! used by callbacks contains a ffi_closure pointer that
-// needs to be freed when the handle references go away (really only one
-// reference is likely--in the ACT_BODY of the callback, but still this is
-// how the GC gets hooked in Ren-C)
+bool Is_Async_Call_Done(const REBVAL *job)
+{
+    return Is_Ffi_Job_Done(&Async_Call_From_Handle(job)->job);
+}
+
+
 //
-void cleanup_ffi_closure(const REBVAL *v) {
-    ffi_closure_free(VAL_HANDLE_POINTER(ffi_closure, v));
+//  Finish_Async_Call: C
+//
+// Wait for a CALL-ASYNC job to finish, and convert its result.  The result
+// can only be collected once, as that is when the arguments are let go.
+//
+REBVAL *Finish_Async_Call(REBVAL *out, const REBVAL *job)
+{
+    struct Reb_Async_Call *call = Async_Call_From_Handle(job);
+    if (call->pinned == nullptr)
+        fail ("FFI: Result of CALL-ASYNC job was already collected");
+
+    // The C function may be calling a WRAP-CALLBACK/FOREIGN callback from
+    // the worker, which won't return until this thread runs it.
+    //
+    Wait_Ffi_Job_Pumping(&call->job);
+
+    if (call->pinned == nullptr)  // a pumped callback waited on it too
+        fail ("FFI: Result of CALL-ASYNC job was already collected");
+
+    const RELVAL *tail;
+    const REBVAL *routine = SPECIFIC(VAL_ARRAY_AT(&tail, call->pinned));
+    REBRIN *rin = ACT_DETAILS(VAL_ACTION(routine));
+
+    if (call->ret == nullptr)
+        Init_Nulled(out);
+    else
+        ffi_to_rebol(out, RIN_RET_SCHEMA(rin), call->ret);
+
+    Release_Async_Pins(call);
+
+    Reap_Abandoned_Async_Calls(false);
+    return out;
+}
+
+
+//
+//  Shutdown_Async_Calls: C
+//
+// Jobs whose HANDLE! is still around are finished by the worker shutdown,
+// but ones that were abandoned need their pins released here.
+//
+void Shutdown_Async_Calls(void)
+{
+    Reap_Abandoned_Async_Calls(true);
+    Shutdown_Ffi_Workers();
 }
 
+
 static void cleanup_cif(const REBVAL *v) {
     FREE(ffi_cif, VAL_HANDLE_POINTER(ffi_cif, v));
 }
@@ -917,6 +2650,169 @@ static void cleanup_args_fftypes(const REBVAL *v) {
     FREE_N(ffi_type*, VAL_HANDLE_LEN(v), VAL_HANDLE_POINTER(ffi_type*, v));
 }
 
+static void cleanup_layout(const REBVAL *v) {
+    FREE_N(REBYTE, VAL_HANDLE_LEN(v), VAL_HANDLE_POINTER(REBYTE, v));
+}
+
+static void cleanup_cif_cache(const REBVAL *v) {
+    struct Reb_Cif_Cache *cache = VAL_HANDLE_POINTER(struct Reb_Cif_Cache, v);
+
+    REBLEN n;
+    for (n = 0; n < FFI_CIF_CACHE_SIZE; ++n) {
+        struct Reb_Cif_Cache_Entry *entry = &cache->entries[n];
+        if (entry->args_fftypes)
+            Release_Cif_Cache_Entry(entry, entry->cif.nargs);
+    }
+
+    FREE(struct Reb_Cif_Cache, cache);
+}
+
+
+#if !defined(FFI_NO_STATS)
+    static void cleanup_ffi_stats(const REBVAL *v) {
+        struct Reb_Ffi_Stats *stats = VAL_HANDLE_POINTER(
+            struct Reb_Ffi_Stats, v
+        );
+        FREE(struct Reb_Ffi_Stats, stats);
+    }
+#endif
+
+
+//
+// Once ffi_prep_cif() has run, libffi has filled in the size and alignment of
+// all the argument types (including structs).  That's enough information to
+// decide where every argument will live in the argument store, so the
+// dispatcher doesn't have to grow and realign a series on each call.
+//
+static void Init_Routine_Layout(REBRIN *r, ffi_cif *cif)
+{
+    REBLEN num_args = cif->nargs;
+    REBLEN layout_size = SIZEOF_ROUTINE_LAYOUT(num_args);
+    struct Reb_Routine_Layout *layout = cast(
+        struct Reb_Routine_Layout*, TRY_ALLOC_N(REBYTE, layout_size)
+    );
+    if (layout == nullptr)
+        fail (Error_No_Memory(layout_size));
+
+    layout->num_args = num_args;
+
+    // The return slot goes at the head, where it gets the store's alignment.
+    // libffi writes integral return values as a full `ffi_arg`, so the slot
+    // is never smaller than that.
+    //
+    REBLEN offset = 0;
+    layout->ret_offset = 0;
+    if (not IS_BLANK(RIN_RET_SCHEMA(r))) {
+        offset = cif->rtype->size;
+        if (offset < sizeof(ffi_arg))
+            offset = sizeof(ffi_arg);
+    }
+
+    REBLEN i;
+    for (i = 0; i < num_args; ++i) {
+        ffi_type *fftype = cif->arg_types[i];
+
+        REBLEN align = fftype->alignment == 0 ? 1 : fftype->alignment;
+        REBLEN padding = offset % align;
+        if (padding != 0)
+            offset += align - padding;
+
+        layout->arg_offsets[i] = offset;
+        offset += fftype->size;
+    }
+
+    // The pointees of `[out T]` and `[inout T]` arguments come last.
+    //
+    REBLEN padding = offset % FFI_OUT_SLOT_SIZE;
+    if (padding != 0)
+        offset += FFI_OUT_SLOT_SIZE - padding;
+    layout->out_offset = offset;
+
+    REBARR *outs = RIN_OUT_PARAMS(r);
+    if (outs)
+        offset += (ARR_LEN(outs) / 3) * FFI_OUT_SLOT_SIZE;
+
+    layout->store_size = offset;
+
+    Init_Handle_Cdata_Managed(
+        RIN_AT(r, IDX_ROUTINE_LAYOUT),
+        layout,
+        layout_size,
+        &cleanup_layout
+    );
+}
+
+
+//
+// The same CIF can be used for every call of a routine that isn't variadic,
+// and once it has been prepared the argument layout and the direct call thunk
+// (if any) can be worked out.  MAKE-ROUTINE does this up front, but a lazy
+// routine waits until its first use (see Bind_Lazy_Routine()).
+//
+static void Prepare_Routine_Cif(REBRIN *r)
+{
+    assert(not RIN_IS_VARIADIC(r));
+
+    ffi_abi abi = RIN_ABI(r);
+    REBLEN num_fixed = RIN_NUM_FIXED_ARGS(r);
+
+    // The CIF must stay alive for the entire the lifetime of the
+    // args_fftypes, apparently.
+    //
+    ffi_cif *cif = TRY_ALLOC(ffi_cif);
+
+    ffi_type **args_fftypes;
+    if (num_fixed == 0)
+        args_fftypes = nullptr;
+    else
+        args_fftypes = TRY_ALLOC_N(ffi_type*, num_fixed);
+
+    REBLEN i;
+    for (i = 0; i < num_fixed; ++i)
+        args_fftypes[i] = SCHEMA_FFTYPE(RIN_ARG_SCHEMA(r, i));
+
+    if (
+        FFI_OK != ffi_prep_cif(
+            cif,
+            abi,
+            num_fixed,
+            IS_BLANK(RIN_RET_SCHEMA(r))
+                ? &ffi_type_void
+                : SCHEMA_FFTYPE(RIN_RET_SCHEMA(r)),
+            args_fftypes  // nullptr if 0 fixed args
+        )
+    ){
+        if (args_fftypes)
+            FREE_N(ffi_type*, num_fixed, args_fftypes);
+        FREE(ffi_cif, cif);
+        fail ("FFI: Couldn't prep CIF");
+    }
+
+    Init_Handle_Cdata_Managed(
+        RIN_AT(r, IDX_ROUTINE_CIF),
+        cif,
+        sizeof(&cif),
+        &cleanup_cif
+    );
+
+    if (args_fftypes == nullptr)
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_ARG_FFTYPES));
+    else
+        Init_Handle_Cdata_Managed(
+            RIN_AT(r, IDX_ROUTINE_ARG_FFTYPES),
+            args_fftypes,
+            num_fixed,
+            &cleanup_args_fftypes
+        );  // lifetime must match cif lifetime
+
+    Init_Routine_Layout(r, cif);
+
+    Init_Integer(
+        RIN_AT(r, IDX_ROUTINE_THUNK),
+        Thunk_Kind_For_Routine(r, abi)
+    );
+}
+
 
 struct Reb_Callback_Invocation {
     ffi_cif *cif;
@@ -927,26 +2823,69 @@ struct Reb_Callback_Invocation {
 
 static REBVAL *callback_dispatcher_core(struct Reb_Callback_Invocation *inv)
 {
-    // Build an array of code to run which represents the call.  The first
-    // item in that array will be the callback function value, and then
-    // the arguments will be the remaining values.
+    struct Reb_Ffi_Stats *stats = Ffi_Stats_If_On(inv->rin);
+    REBI64 start_ns = stats ? Ffi_Nanoseconds() : 0;
+
+    // The code to run which represents the call is an array whose first item
+    // is the callback function value, and then the arguments.  Comparators
+    // passed to things like qsort() are called millions of times, so the
+    // array is kept in the RIN and reused (unless it's already running).
+    //
+    // !!! That only saves making the array.  Each call still evaluates it,
+    // which pushes a frame for the action and fulfills its arguments from
+    // the array as any call does, and it's all inside a full rebRescue()
+    // (see callback_dispatcher()).  What should be done instead is to keep
+    // an action frame per callback, pushed with the core's frame API (as
+    // MAKE_Struct() does for its evaluation), and refill its argument cells
+    // in place--with a trap around it cheaper than rebRescue().  That isn't
+    // done yet, as it has to be written and tested against the core's
+    // action dispatch, which changes more often than the evaluator entry
+    // points used here.
     //
-    REBARR *code = Make_Array(1 + inv->cif->nargs);
-    RELVAL *elem = ARR_HEAD(code);
-    Copy_Cell(elem, RIN_CALLBACK_ACTION(inv->rin));
-    ++elem;
+    REBVAL *slot = RIN_AT(inv->rin, IDX_ROUTINE_INVOCATION);
+
+    REBARR *code;
+    if (IS_BLOCK(slot)) {
+        code = VAL_ARRAY_KNOWN_MUTABLE(slot);
+        Init_Blank(slot);  // taken, a reentrant call must make its own
+    }
+    else {
+        code = Make_Array(1 + inv->cif->nargs);
+        Copy_Cell(ARR_HEAD(code), RIN_CALLBACK_ACTION(inv->rin));
+
+        REBLEN n;
+        for (n = 1; n <= inv->cif->nargs; ++n)
+            Init_Blank(ARR_AT(code, n));
+
+        SET_SERIES_LEN(code, 1 + inv->cif->nargs);
+        Manage_Series(code);  // DO requires managed arrays
+    }
+
+    RELVAL *elem = ARR_AT(code, 1);
 
     REBLEN i;
-    for (i = 0; i != inv->cif->nargs; ++i, ++elem)
-        ffi_to_rebol(elem, RIN_ARG_SCHEMA(inv->rin, i), inv->args[i]);
+    for (i = 0; i != inv->cif->nargs; ++i, ++elem) {
+        const REBVAL *schema = RIN_ARG_SCHEMA(inv->rin, i);
+        ffi_to_rebol(elem, schema, inv->args[i]);
+
+        // Other argument types convert to values that evaluate to themselves,
+        // but a REBVAL could be anything (e.g. a WORD!).
+        //
+        if (IS_WORD(schema) and VAL_WORD_ID(schema) == SYM_REBVAL)
+            Quotify(elem, 1);
+    }
 
-    SET_SERIES_LEN(code, 1 + inv->cif->nargs);
-    Manage_Series(code);  // DO requires managed arrays (guarded while running)
+    REBI64 call_ns = stats ? Ffi_Nanoseconds() : 0;
 
     DECLARE_LOCAL (result);
     if (Do_At_Mutable_Throws(result, code, 0, SPECIFIED))
         fail (Error_No_Catch_For_Throw(result));  // caller will panic()
 
+    REBI64 convert_ns = stats ? Ffi_Nanoseconds() : 0;
+
+    if (IS_BLANK(slot))  // give back for reuse (unless a reentrant call did)
+        Init_Block(slot, code);
+
     if (inv->cif->rtype->type == FFI_TYPE_VOID)
         assert(IS_BLANK(RIN_RET_SCHEMA(inv->rin)));
     else {
@@ -960,6 +2899,13 @@ static REBVAL *callback_dispatcher_core(struct Reb_Callback_Invocation *inv)
         );
     }
 
+    if (stats) {
+        ++stats->calls;
+        stats->marshal_ns += call_ns - start_ns;
+        stats->call_ns += convert_ns - call_ns;
+        stats->convert_ns += Ffi_Nanoseconds() - convert_ns;
+    }
+
     return nullptr;  // return result not used
 }
 
@@ -991,7 +2937,18 @@ void callback_dispatcher(
     assert(not RIN_IS_VARIADIC(inv.rin));
     assert(cif->nargs == RIN_NUM_FIXED_ARGS(inv.rin));
 
+  #if !defined(FFI_NO_STATS)
+    struct Reb_Ffi_Stats *stats = RIN_STATS(inv.rin);
+    if (stats->depth++ != 0 and Ffi_Stats_On)
+        ++stats->reentries;
+  #endif
+
     REBVAL *error = rebRescue(cast(REBDNG*, callback_dispatcher_core), &inv);
+
+  #if !defined(FFI_NO_STATS)
+    --stats->depth;
+  #endif
+
     if (error != nullptr) {
         //
         // If a callback encounters an un-trapped error in mid-run, there's
@@ -1007,6 +2964,405 @@ void callback_dispatcher(
 }
 
 
+//=//// CONTEXT CALLBACKS //////////////////////////////////////////////////=//
+//
+// See the comments on Reb_Callback_Signature.  The signatures are kept in a
+// list, which stays short since a program only has so many shapes of
+// callback.  The context table is an array of entries, with the free ones
+// linked through `next_free` (as index + 1, so 0 ends the list).
+//
+
+static struct Reb_Callback_Signature *Callback_Signatures = nullptr;
+
+static struct Reb_Context_Entry *Context_Table = nullptr;
+static REBLEN Context_Table_Len = 0;  // entries allocated
+static REBLEN Context_Table_Used = 0;  // entries ever handed out
+static REBLEN Context_Free = 0;  // first free entry as index + 1, or 0
+
+#define FFI_CONTEXT_INDEX_MASK \
+    ((cast(uintptr_t, 1) << FFI_CONTEXT_INDEX_BITS) - 1)
+
+static uintptr_t Context_Pointer(REBLEN index) {
+    return (Context_Table[index].reuses << FFI_CONTEXT_INDEX_BITS)
+        | (index + 1);
+}
+
+// The callback a context pointer is for, or nullptr if it isn't one that
+// is live.
+//
+static REBRIN *Rin_For_Context(uintptr_t ctx)
+{
+    REBLEN index = cast(REBLEN, ctx & FFI_CONTEXT_INDEX_MASK);
+    if (index == 0 or index > Context_Table_Used)
+        return nullptr;
+    --index;
+
+    if (Context_Pointer(index) != ctx)
+        return nullptr;
+    return Context_Table[index].rin;  // nullptr if freed
+}
+
+static REBLEN Claim_Context_Entry(REBRIN *r)
+{
+    REBLEN index;
+    if (Context_Free != 0) {
+        index = Context_Free - 1;
+        Context_Free = Context_Table[index].next_free;
+    }
+    else {
+        if (Context_Table_Used == Context_Table_Len) {
+            REBLEN len = Context_Table_Len == 0 ? 64 : Context_Table_Len * 2;
+            if (len > FFI_CONTEXT_INDEX_MASK)
+                len = FFI_CONTEXT_INDEX_MASK;
+            if (len == Context_Table_Used)
+                fail ("FFI: Too many WRAP-CALLBACK/CONTEXT callbacks alive");
+
+            struct Reb_Context_Entry *table = TRY_ALLOC_N(
+                struct Reb_Context_Entry, len
+            );
+            if (table == nullptr)
+                fail (Error_No_Memory(len * sizeof(struct Reb_Context_Entry)));
+            if (Context_Table) {
+                memcpy(
+                    table,
+                    Context_Table,
+                    Context_Table_Len * sizeof(struct Reb_Context_Entry)
+                );
+                FREE_N(
+                    struct Reb_Context_Entry, Context_Table_Len, Context_Table
+                );
+            }
+            Context_Table = table;
+            Context_Table_Len = len;
+        }
+        index = Context_Table_Used++;
+        Context_Table[index].reuses = 0;
+    }
+
+    Context_Table[index].rin = r;
+    return index;
+}
+
+// The HANDLE! in a context callback's RIN gives back its entry when GC'd.
+//
+static void cleanup_callback_context(const REBVAL *v)
+{
+    uintptr_t ctx = cast(uintptr_t, VAL_HANDLE_POINTER(REBYTE, v));
+    if (Rin_For_Context(ctx) == nullptr)
+        return;  // table was freed by Shutdown_Callback_Contexts()
+
+    REBLEN index = cast(REBLEN, ctx & FFI_CONTEXT_INDEX_MASK) - 1;
+    struct Reb_Context_Entry *entry = &Context_Table[index];
+    entry->rin = nullptr;
+    ++entry->reuses;  // so the old context pointer stops working
+    entry->next_free = Context_Free;
+    Context_Free = index + 1;
+}
+
+// What the shared closure of a signature runs: find the callback from the
+// context argument, and dispatch to it as if it had its own closure.
+//
+static void context_callback_dispatcher(
+    ffi_cif *cif,
+    void *ret,
+    void **args,
+    void *user_data
+){
+    struct Reb_Callback_Signature *sig = cast(
+        struct Reb_Callback_Signature*, user_data
+    );
+    void *context = *cast(void**, args[sig->context_index]);
+
+    REBRIN *r = Rin_For_Context(cast(uintptr_t, context));
+    if (r == nullptr)
+        panic ("FFI: Callback called with a stale or bad context pointer");
+
+    callback_dispatcher(cif, ret, args, r);
+}
+
+static struct Reb_Callback_Signature *Callback_Signature_For(
+    REBRIN *r,
+    REBLEN context_index
+){
+    ffi_abi abi = RIN_ABI(r);
+    REBLEN num_args = RIN_NUM_FIXED_ARGS(r);
+    if (num_args > FFI_CONTEXT_MAX_ARGS)
+        fail ("FFI: WRAP-CALLBACK/CONTEXT takes at most 16 arguments");
+
+    // Struct types could be GC'd along with their ffi_type, so only plain
+    // type words can be part of a signature that lives on.
+    //
+    SYMID ret_sym = SYM_0;
+    if (not IS_BLANK(RIN_RET_SCHEMA(r))) {
+        if (not IS_WORD(RIN_RET_SCHEMA(r)))
+            fail ("FFI: WRAP-CALLBACK/CONTEXT can't use struct types");
+        ret_sym = VAL_WORD_ID(RIN_RET_SCHEMA(r));
+    }
+
+    SYMID arg_syms[FFI_CONTEXT_MAX_ARGS];
+    REBLEN n;
+    for (n = 0; n < num_args; ++n) {
+        const REBVAL *schema = RIN_ARG_SCHEMA(r, n);
+        if (not IS_WORD(schema))
+            fail ("FFI: WRAP-CALLBACK/CONTEXT can't use struct types");
+        arg_syms[n] = VAL_WORD_ID(schema);
+    }
+
+    if (arg_syms[context_index] != SYM_POINTER)
+        fail ("FFI: A callback's context argument must be a [pointer]");
+
+    struct Reb_Callback_Signature *sig = Callback_Signatures;
+    for (; sig != nullptr; sig = sig->next) {
+        if (
+            sig->abi == abi
+            and sig->context_index == context_index
+            and sig->ret_sym == ret_sym
+            and sig->cif.nargs == num_args
+            and memcmp(sig->arg_syms, arg_syms, num_args * sizeof(SYMID)) == 0
+        ){
+            return sig;
+        }
+    }
+
+    struct Reb_Closure_Slot *slot = Claim_Closure_Slot();
+
+    sig = TRY_ALLOC(struct Reb_Callback_Signature);
+    if (sig == nullptr) {
+        Free_Closure_Slot(slot);
+        --Closure_Pool.num_live;
+        fail (Error_No_Memory(sizeof(struct Reb_Callback_Signature)));
+    }
+    sig->slot = slot;
+    sig->abi = abi;
+    sig->context_index = context_index;
+    sig->ret_sym = ret_sym;
+    for (n = 0; n < num_args; ++n) {
+        sig->arg_syms[n] = arg_syms[n];
+        sig->args_fftypes[n] = Get_FFType_For_Sym(arg_syms[n]);
+    }
+
+    if (
+        FFI_OK != ffi_prep_cif(
+            &sig->cif,
+            abi,
+            num_args,
+            ret_sym == SYM_0 ? &ffi_type_void : Get_FFType_For_Sym(ret_sym),
+            sig->args_fftypes
+        )
+        or FFI_OK != ffi_prep_closure_loc(
+            slot->closure,
+            &sig->cif,
+            &context_callback_dispatcher,
+            sig,  // every callback of the signature gets the same user_data
+            slot->thunk
+        )
+    ){
+        FREE(struct Reb_Callback_Signature, sig);
+        Free_Closure_Slot(slot);
+        --Closure_Pool.num_live;
+        fail ("FFI: Couldn't prep shared callback closure");
+    }
+
+    sig->next = Callback_Signatures;
+    Callback_Signatures = sig;
+    return sig;
+}
+
+
+//
+//  Init_Context_Callback: C
+//
+// Finish a callback made for WRAP-CALLBACK/CONTEXT.  It must have been made
+// lazily, so it has no CIF of its own--it gets its signature's (which lives
+// until shutdown) and the C function pointer of the signature's closure.
+//
+void Init_Context_Callback(REBRIN *r, REBLEN context_index)
+{
+    assert(RIN_IS_CALLBACK(r) and not RIN_IS_VARIADIC(r));
+    assert(IS_BLANK(RIN_AT(r, IDX_ROUTINE_CIF)));
+    assert(context_index < RIN_NUM_FIXED_ARGS(r));
+
+    struct Reb_Callback_Signature *sig = Callback_Signature_For(
+        r, context_index
+    );
+
+    Init_Handle_Cdata(RIN_AT(r, IDX_ROUTINE_CIF), &sig->cif, sizeof(ffi_cif));
+    Init_Routine_Layout(r, &sig->cif);
+    Init_Integer(
+        RIN_AT(r, IDX_ROUTINE_THUNK),
+        Thunk_Kind_For_Routine(r, RIN_ABI(r))
+    );
+
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_CLOSURE));  // the signature has it
+
+    CFUNC *cfunc_thunk;  // see WRAP-CALLBACK for why this isn't a cast
+    memcpy(&cfunc_thunk, &sig->slot->thunk, sizeof(cfunc_thunk));
+    Init_Handle_Cfunc(RIN_AT(r, IDX_ROUTINE_CFUNC), cfunc_thunk);
+
+    REBLEN index = Claim_Context_Entry(r);
+    Init_Handle_Cdata_Managed(
+        RIN_AT(r, IDX_ROUTINE_CONTEXT),
+        cast(void*, Context_Pointer(index)),
+        sizeof(uintptr_t),
+        &cleanup_callback_context
+    );
+}
+
+
+//
+//  Shutdown_Callback_Contexts: C
+//
+// Frees the shared closures and the context table.  (Any callbacks made with
+// WRAP-CALLBACK/CONTEXT that are still alive can't be called after this.)
+//
+void Shutdown_Callback_Contexts(void)
+{
+    while (Callback_Signatures) {
+        struct Reb_Callback_Signature *sig = Callback_Signatures;
+        Callback_Signatures = sig->next;
+
+        Free_Closure_Slot(sig->slot);
+        --Closure_Pool.num_live;
+        FREE(struct Reb_Callback_Signature, sig);
+    }
+
+    if (Context_Table)
+        FREE_N(struct Reb_Context_Entry, Context_Table_Len, Context_Table);
+    Context_Table = nullptr;
+    Context_Table_Len = 0;
+    Context_Table_Used = 0;
+    Context_Free = 0;
+}
+
+
+//
+// The paramlist of the action has been pushed to the data stack from
+// `dsp_orig` (starting with a slot for the archetype), and the schemas are
+// ready.  Make the action and fill in all of the routine details that don't
+// depend on whether it's a routine or a callback.
+//
+static REBACT *Finish_Ffi_Action(
+    REBDSP dsp_orig,
+    REBARR *args_schemas,  // managed
+    option(REBARR*) outs,  // managed, see IDX_ROUTINE_OUT_PARAMS
+    const REBVAL *ret_schema,
+    ffi_abi abi,
+    bool is_variadic,
+    bool is_reentrant,
+    bool lazy
+){
+    REBARR *paramlist = Pop_Stack_Values_Core(
+        dsp_orig,
+        SERIES_MASK_PARAMLIST | NODE_FLAG_MANAGED
+    );
+
+    // Initializing the array head to a void signals the Make_Action() that
+    // it is supposed to touch up the paramlist to point to the action.
+    //
+    // !!! FFI needs update to the new keylist conventions, with a REBSER*
+    // of symbols, instead of having the symbols in the key.   Much of this
+    // frame building is likely better expressed as user code that then
+    // passes the constructed FRAME! in to be coupled with the routine
+    // dispatcher.
+    //
+    Init_Unreadable_Void(ARR_HEAD(paramlist));
+
+    REBACT *action = Make_Action(
+        paramlist,
+        &Routine_Dispatcher,
+        IDX_ROUTINE_MAX  // details array len
+    );
+
+    REBRIN *r = ACT_DETAILS(action);
+
+    Init_Integer(RIN_AT(r, IDX_ROUTINE_ABI), abi);
+
+    // Caller must update these in the returned function.
+    //
+    TRASH_CELL_IF_DEBUG(RIN_AT(r, IDX_ROUTINE_CFUNC));
+    TRASH_CELL_IF_DEBUG(RIN_AT(r, IDX_ROUTINE_CLOSURE));
+    TRASH_CELL_IF_DEBUG(RIN_AT(r, IDX_ROUTINE_ORIGIN));  // LIBRARY!/ACTION!
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_NAME));  // MAKE-ROUTINE sets
+
+    Copy_Cell(RIN_AT(r, IDX_ROUTINE_RET_SCHEMA), ret_schema);
+
+    Init_Logic(RIN_AT(r, IDX_ROUTINE_IS_VARIADIC), is_variadic);
+    Init_Logic(RIN_AT(r, IDX_ROUTINE_IS_REENTRANT), is_reentrant);
+
+    ASSERT_ARRAY(args_schemas);
+    Init_Block(RIN_AT(r, IDX_ROUTINE_ARG_SCHEMAS), args_schemas);
+
+    if (outs)
+        Init_Block(RIN_AT(r, IDX_ROUTINE_OUT_PARAMS), unwrap(outs));
+    else
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_OUT_PARAMS));
+
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_TEXT_PARAMS));  // spec allocator sets
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_TEXT_RETURN));
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_TEXT_FREE));
+    Init_Logic(RIN_AT(r, IDX_ROUTINE_HAS_INTO), false);
+
+    if (RIN_IS_VARIADIC(r)) {
+        //
+        // Each individual call needs to use `ffi_prep_cif_var` to make the
+        // proper variadic CIF for that call.
+        //
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_CIF));
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_LAYOUT));
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_ARG_FFTYPES));
+        Init_Integer(RIN_AT(r, IDX_ROUTINE_THUNK), FFI_THUNK_NONE);
+
+        // ...but calls tend to repeat the same few type sequences, so the
+        // CIFs made for them are kept around for reuse.
+        //
+        struct Reb_Cif_Cache *cache = TRY_ALLOC(struct Reb_Cif_Cache);
+        if (cache == nullptr)
+            fail (Error_No_Memory(sizeof(struct Reb_Cif_Cache)));
+        memset(cache, 0, sizeof(struct Reb_Cif_Cache));  // all entries unused
+        Init_Handle_Cdata_Managed(
+            RIN_AT(r, IDX_ROUTINE_CIF_CACHE),
+            cache,
+            sizeof(struct Reb_Cif_Cache),
+            &cleanup_cif_cache
+        );
+    }
+    else if (lazy) {
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_CIF));  // see Bind_Lazy_Routine()
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_LAYOUT));
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_ARG_FFTYPES));
+        Init_Integer(RIN_AT(r, IDX_ROUTINE_THUNK), FFI_THUNK_NONE);
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_CIF_CACHE));
+    }
+    else {
+        Prepare_Routine_Cif(r);
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_CIF_CACHE));
+    }
+
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_INVOCATION));  // made on first callback
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_FOREIGN));  // see WRAP-CALLBACK/FOREIGN
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_CONTEXT));  // see WRAP-CALLBACK/CONTEXT
+
+  #if defined(FFI_NO_STATS)
+    Init_Blank(RIN_AT(r, IDX_ROUTINE_STATS));
+  #else
+    struct Reb_Ffi_Stats *stats = TRY_ALLOC(struct Reb_Ffi_Stats);
+    if (stats == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Ffi_Stats)));
+    memset(stats, 0, sizeof(struct Reb_Ffi_Stats));
+    Init_Handle_Cdata_Managed(
+        RIN_AT(r, IDX_ROUTINE_STATS),
+        stats,
+        sizeof(struct Reb_Ffi_Stats),
+        &cleanup_ffi_stats
+    );
+  #endif
+
+    SET_SERIES_LEN(r, IDX_ROUTINE_MAX);
+
+    return action;
+}
+
+
 //
 //  Alloc_Ffi_Action_For_Spec: C
 //
@@ -1032,7 +3388,18 @@ void callback_dispatcher(
 //     return: [type] "note"
 // ]
 //
-REBACT *Alloc_Ffi_Action_For_Spec(REBVAL *ffi_spec, ffi_abi abi) {
+// An argument's type may also be `[out T]` or `[inout T]` for a C `T*` the
+// function writes a result through (see Out_Param_Pointee()), or `[utf8]`
+// or `[utf16]` for a string (see Text_Encoding_For_Block()).
+//
+// With `lazy`, a non-variadic routine's CIF isn't prepared here--it is done
+// by Bind_Lazy_Routine() when the routine is first used.
+//
+REBACT *Alloc_Ffi_Action_For_Spec(
+    REBVAL *ffi_spec,
+    ffi_abi abi,
+    bool lazy
+){
     assert(IS_BLOCK(ffi_spec));
 
     // Build the paramlist on the data stack.  First slot is reserved for the
@@ -1062,8 +3429,23 @@ REBACT *Alloc_Ffi_Action_For_Spec(REBVAL *ffi_spec, ffi_abi abi) {
     Init_Blank(ret_schema);  // ret_schema defaults blank (e.g. void C func)
     PUSH_GC_GUARD(ret_schema);
 
-    REBLEN num_fixed = 0;  // number of fixed (non-variadic) arguments
+    REBARR *outs = Make_Array(0);  // see IDX_ROUTINE_OUT_PARAMS
+    Manage_Series(outs);
+    PUSH_GC_GUARD(outs);
+
+    REBARR *texts = Make_Array(0);  // see IDX_ROUTINE_TEXT_PARAMS
+    Manage_Series(texts);
+    PUSH_GC_GUARD(texts);
+
+    int text_return = -1;  // see IDX_ROUTINE_TEXT_RETURN
+
+    DECLARE_LOCAL (text_free);  // see IDX_ROUTINE_TEXT_FREE
+    Init_Blank(text_free);
+    PUSH_GC_GUARD(text_free);
+
     bool is_variadic = false;  // default to not being variadic
+    bool is_reentrant = false;  // <reentrant> says workers may call it
+    bool has_into = false;  // <into> adds an argument to return a struct in
 
     const RELVAL *tail;
     const RELVAL *item = VAL_ARRAY_AT(&tail, ffi_spec);
@@ -1106,17 +3488,71 @@ REBACT *Alloc_Ffi_Action_For_Spec(REBVAL *ffi_spec, ffi_abi abi) {
                 DECLARE_LOCAL (block);
                 Derelativize(block, item, VAL_SPECIFIER(ffi_spec));
 
-                Schema_From_Block_May_Fail(
-                    Alloc_Tail_Array(args_schemas),  // schema (out)
-                    DS_PUSH(),  // param (out)
-                    block,  // block (in)
-                    name
-                );
+                DECLARE_LOCAL (deallocator);
+                int encoding = Text_Encoding_For_Block(deallocator, block);
+                if (encoding >= 0) {
+                    if (not IS_BLANK(deallocator))
+                        fail ("FFI: Only a text return type can say free");
+
+                    REBLEN index = ARR_LEN(args_schemas);
+                    Init_Word(
+                        Alloc_Tail_Array(args_schemas),
+                        Canon(SYM_POINTER)
+                    );
+
+                    Init_Integer(Alloc_Tail_Array(texts), index);
+                    Init_Integer(Alloc_Tail_Array(texts), encoding);
+                    Init_Blank(Alloc_Tail_Array(texts));  // no cached TEXT!
+                    Init_Blank(Alloc_Tail_Array(texts));  // ...or conversion
+
+                    Init_Param(
+                        DS_PUSH(),
+                        REB_P_NORMAL,
+                        name,
+                        FLAGIT_KIND(REB_TEXT) | FLAGIT_KIND(REB_NULL)
+                    );
+                    break;
+                }
+
+                bool inout;
+                const REBSTR *pointee = Out_Param_Pointee(&inout, block);
+                if (pointee == nullptr) {
+                    Schema_From_Block_May_Fail(
+                        Alloc_Tail_Array(args_schemas),  // schema (out)
+                        DS_PUSH(),  // param (out)
+                        block,  // block (in)
+                        name
+                    );
+                    break;
+                }
+
+                // C gets a pointer, which Routine_Dispatcher() aims into
+                // the argument store.  Only an `inout` argument is taken from
+                // the callsite, as its pointee's initial value.
+                //
+                Init_Word(Alloc_Tail_Array(args_schemas), Canon(SYM_POINTER));
 
-                ++num_fixed;
+                REBLEN index = ARR_LEN(args_schemas) - 1;
+                Init_Integer(Alloc_Tail_Array(outs), index);
+                Init_Logic(Alloc_Tail_Array(outs), inout);
+                Init_Word(Alloc_Tail_Array(outs), pointee);
+
+                if (inout)
+                    Init_Param_For_Schema(DS_PUSH(), ARR_LAST(outs), name);
+                else
+                    Init_Param(DS_PUSH(), REB_P_LOCAL, name, TS_VALUE);
             }
             break; }
 
+          case REB_TAG: {
+            if (Tag_Is_Spelled(item, "reentrant"))
+                is_reentrant = true;
+            else if (Tag_Is_Spelled(item, "into"))
+                has_into = true;
+            else
+                fail (SPECIFIC(item));
+            break; }
+
           case REB_SET_WORD:
             switch (VAL_WORD_ID(item)) {
               case SYM_RETURN:{
@@ -1128,6 +3564,13 @@ REBACT *Alloc_Ffi_Action_For_Spec(REBVAL *ffi_spec, ffi_abi abi) {
                 DECLARE_LOCAL (block);
                 Derelativize(block, item, VAL_SPECIFIER(ffi_spec));
 
+                int encoding = Text_Encoding_For_Block(text_free, block);
+                if (encoding >= 0) {
+                    Init_Word(ret_schema, Canon(SYM_POINTER));
+                    text_return = encoding;
+                    break;
+                }
+
                 Schema_From_Block_May_Fail(
                     ret_schema,
                     nullptr,  // dummy (return/output has no arg to typecheck)
@@ -1146,105 +3589,139 @@ REBACT *Alloc_Ffi_Action_For_Spec(REBVAL *ffi_spec, ffi_abi abi) {
         }
     }
 
-    REBARR *paramlist = Pop_Stack_Values_Core(
-        dsp_orig,
-        SERIES_MASK_PARAMLIST | NODE_FLAG_MANAGED
-    );
+    if (
+        is_variadic
+        and (ARR_LEN(outs) != 0 or ARR_LEN(texts) != 0 or text_return >= 0)
+    ){
+        fail ("FFI: Variadic routines can't have out or text parameters");
+    }
 
-    // Initializing the array head to a void signals the Make_Action() that
-    // it is supposed to touch up the paramlist to point to the action.
+    // With <into>, the last argument is a STRUCT! that a struct return value
+    // is written into, instead of a new STRUCT! being made for each call.  A
+    // BLANK! gets the usual new one.
     //
-    // !!! FFI needs update to the new keylist conventions, with a REBSER*
-    // of symbols, instead of having the symbols in the key.   Much of this
-    // frame building is likely better expressed as user code that then
-    // passes the constructed FRAME! in to be coupled with the routine
-    // dispatcher.
-    //
-    Init_Unreadable_Void(ARR_HEAD(paramlist));
+    if (has_into) {
+        if (is_variadic or not IS_BLOCK(ret_schema))
+            fail ("FFI: <into> needs a non-variadic struct! return type");
+
+        Init_Param(
+            DS_PUSH(),
+            REB_P_NORMAL,
+            Intern_UTF8_Managed(cb_cast("into"), 4),
+            FLAGIT_KIND(REB_CUSTOM) | FLAGIT_KIND(REB_BLANK)
+        );
+    }
 
-    REBACT *action = Make_Action(
-        paramlist,
-        &Routine_Dispatcher,
-        IDX_ROUTINE_MAX  // details array len
+    REBACT *action = Finish_Ffi_Action(
+        dsp_orig,
+        args_schemas,
+        ARR_LEN(outs) == 0 ? nullptr : outs,
+        ret_schema,
+        abi,
+        is_variadic,
+        is_reentrant,
+        lazy
     );
 
     REBRIN *r = ACT_DETAILS(action);
+    if (ARR_LEN(texts) != 0)
+        Init_Block(RIN_AT(r, IDX_ROUTINE_TEXT_PARAMS), texts);
+    if (text_return >= 0)
+        Init_Integer(RIN_AT(r, IDX_ROUTINE_TEXT_RETURN), text_return);
+    Copy_Cell(RIN_AT(r, IDX_ROUTINE_TEXT_FREE), text_free);
+    Init_Logic(RIN_AT(r, IDX_ROUTINE_HAS_INTO), has_into);
+
+    DROP_GC_GUARD(text_free);
+    DROP_GC_GUARD(texts);
+    DROP_GC_GUARD(outs);
+    DROP_GC_GUARD(ret_schema);
+    DROP_GC_GUARD(args_schemas);
 
-    Init_Integer(RIN_AT(r, IDX_ROUTINE_ABI), abi);
+    return action;
+}
 
-    // Caller must update these in the returned function.
-    //
-    TRASH_CELL_IF_DEBUG(RIN_AT(r, IDX_ROUTINE_CFUNC));
-    TRASH_CELL_IF_DEBUG(RIN_AT(r, IDX_ROUTINE_CLOSURE));
-    TRASH_CELL_IF_DEBUG(RIN_AT(r, IDX_ROUTINE_ORIGIN));  // LIBRARY!/ACTION!
 
-    Copy_Cell(RIN_AT(r, IDX_ROUTINE_RET_SCHEMA), ret_schema);
-    DROP_GC_GUARD(ret_schema);
 
-    Init_Logic(RIN_AT(r, IDX_ROUTINE_IS_VARIADIC), is_variadic);
+//
+//  Alloc_Ffi_Action_For_Schemas: C
+//
+// Makes the same action Alloc_Ffi_Action_For_Spec() would, from schemas that
+// already exist instead of a spec block.  This is for loading binding images
+// (see %c-image.c), where the schemas were made without running any specs.
+//
+REBACT *Alloc_Ffi_Action_For_Schemas(
+    REBARR *args_schemas,  // managed, one schema per fixed argument
+    const REBSTR **arg_names,  // parameter name for each fixed argument
+    const REBVAL *ret_schema,  // BLANK! if the routine returns void
+    ffi_abi abi,
+    bool is_variadic,
+    bool is_reentrant,
+    bool lazy
+){
+    REBDSP dsp_orig = DSP;
+    Init_Unreadable_Void(DS_PUSH());  // GC-safe form of "trash"
 
-    ASSERT_ARRAY(args_schemas);
-    Init_Block(RIN_AT(r, IDX_ROUTINE_ARG_SCHEMAS), args_schemas);
-    DROP_GC_GUARD(args_schemas);
+    REBLEN num_fixed = ARR_LEN(args_schemas);
+    REBLEN i;
+    for (i = 0; i < num_fixed; ++i)
+        Init_Param_For_Schema(
+            DS_PUSH(),
+            ARR_AT(args_schemas, i),
+            arg_names[i]
+        );
 
-    if (RIN_IS_VARIADIC(r)) {
-        //
-        // Each individual call needs to use `ffi_prep_cif_var` to make the
-        // proper variadic CIF for that call.
-        //
-        Init_Blank(RIN_AT(r, IDX_ROUTINE_CIF));
-        Init_Blank(RIN_AT(r, IDX_ROUTINE_ARG_FFTYPES));
+    if (is_variadic) {  // same as the `...` in Alloc_Ffi_Action_For_Spec()
+        Init_Param(
+            DS_PUSH(),
+            REB_P_NORMAL,
+            Canon(SYM_VARARGS),
+            TS_VALUE & ~FLAGIT_KIND(REB_VARARGS)
+        );
+        TYPE_SET(DS_TOP, REB_TS_VARIADIC);
     }
-    else {
-        // The same CIF can be used for every call of the routine if it is
-        // not variadic.  The CIF must stay alive for the entire the lifetime
-        // of the args_fftypes, apparently.
-        //
-        ffi_cif *cif = TRY_ALLOC(ffi_cif);
 
-        ffi_type **args_fftypes;
-        if (num_fixed == 0)
-            args_fftypes = nullptr;
-        else
-            args_fftypes = TRY_ALLOC_N(ffi_type*, num_fixed);
-
-        REBLEN i;
-        for (i = 0; i < num_fixed; ++i)
-            args_fftypes[i] = SCHEMA_FFTYPE(RIN_ARG_SCHEMA(r, i));
+    return Finish_Ffi_Action(
+        dsp_orig,
+        args_schemas,
+        nullptr,  // images don't hold routines with out parameters
+        ret_schema,
+        abi,
+        is_variadic,
+        is_reentrant,
+        lazy
+    );
+}
 
-        if (
-            FFI_OK != ffi_prep_cif(
-                cif,
-                abi,
-                num_fixed,
-                IS_BLANK(RIN_RET_SCHEMA(r))
-                    ? &ffi_type_void
-                    : SCHEMA_FFTYPE(RIN_RET_SCHEMA(r)),
-                args_fftypes  // nullptr if 0 fixed args
-            )
-        ){
-            fail ("FFI: Couldn't prep CIF");
-        }
+//
+//  Bind_Lazy_Routine: C
+//
+// MAKE-ROUTINE/LAZY doesn't look up the linker name, or prepare the CIF.
+// That makes binding a library of hundreds of functions cheap when a program
+// only calls a few of them; the cost is paid here, on the first call (or
+// ADDR-OF, or CALL-MANY...) instead.
+//
+// The CIF is prepared before the symbol is looked up, and the CFUNC slot is
+// only filled in once both have succeeded.  So a routine whose symbol is
+// missing stays unbound, and fails again the next time it's used.
+//
+void Bind_Lazy_Routine(REBRIN *r)
+{
+    assert(IS_BLANK(RIN_AT(r, IDX_ROUTINE_CFUNC)));
 
-        Init_Handle_Cdata_Managed(
-            RIN_AT(r, IDX_ROUTINE_CIF),
-            cif,
-            sizeof(&cif),
-            &cleanup_cif
-        );
+    REBLIB *lib = RIN_LIB(r);
+    if (lib == nullptr or IS_LIB_CLOSED(lib))
+        fail (Error_Bad_Library_Raw());
 
-        if (args_fftypes == nullptr)
-            Init_Blank(RIN_AT(r, IDX_ROUTINE_ARG_FFTYPES));
-        else
-            Init_Handle_Cdata_Managed(
-                RIN_AT(r, IDX_ROUTINE_ARG_FFTYPES),
-                args_fftypes,
-                num_fixed,
-                &cleanup_args_fftypes
-            );  // lifetime must match cif lifetime
-    }
+    if (not RIN_IS_VARIADIC(r) and IS_BLANK(RIN_AT(r, IDX_ROUTINE_CIF)))
+        Prepare_Routine_Cif(r);
 
-    SET_SERIES_LEN(r, IDX_ROUTINE_MAX);
+    const REBVAL *name = RIN_AT(r, IDX_ROUTINE_NAME);
+    CFUNC *cfunc = Find_Function(
+        LIB_FD(lib),
+        cast(const char*, VAL_UTF8_AT(name))
+    );
+    if (cfunc == nullptr)
+        fail ("FFI: Couldn't find function in library");
 
-    return action;
+    Init_Handle_Cfunc(RIN_AT(r, IDX_ROUTINE_CFUNC), cfunc);
 }
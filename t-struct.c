@@ -26,16 +26,32 @@
 
 #include "reb-struct.h"
 
+// Array fields of C scalar types are exchanged as VECTOR!s, see notes in
+// %t-routine.c about the static linkage dependency this implies.
+//
+#include "sys-vector.h"
+
 
 // The managed HANDLE! for a ffi_type will have a reference in structs that
 // use it.  Basic non-struct FFI_TYPE_XXX use the stock ffi_type_xxx pointers
 // that do not have to be freed, so they use simple HANDLE! which do not
 // register this cleanup hook.
 //
+// A struct's `elements` array is followed (after its nullptr terminator) by
+// a second nullptr-terminated list of the array types it owns, which are
+// freed along with it.  See Make_Array_FFType().
+//
 static void cleanup_ffi_type(const REBVAL *v) {
     ffi_type *fftype = VAL_HANDLE_POINTER(ffi_type, v);
-    if (fftype->type == FFI_TYPE_STRUCT)
+    if (fftype->type == FFI_TYPE_STRUCT) {
+        ffi_type **owned = fftype->elements;
+        while (*owned)
+            ++owned;
+        for (++owned; *owned; ++owned)
+            free(*owned);
+
         free(fftype->elements);
+    }
     free(fftype);
 }
 
@@ -49,18 +65,83 @@ static void fail_if_non_accessible(REBSTU *stu)
     }
 }
 
+
+// Load the C scalar of the given kind at `p` as an INTEGER! or DECIMAL! (or
+// the cell pointed to, for REBVAL).  Structs aren't scalars, and are handled
+// by the callers which have the schema for them.
+//
+static void Get_Scalar_At(
+    RELVAL *out,
+    const REBYTE *p,
+    enum Reb_Field_Kind kind
+){
+    switch (kind) {
+      case FLD_KIND_UINT8:
+        Init_Integer(out, *cast(const uint8_t*, p));
+        break;
+
+      case FLD_KIND_INT8:
+        Init_Integer(out, *cast(const int8_t*, p));
+        break;
+
+      case FLD_KIND_UINT16:
+        Init_Integer(out, *cast(const uint16_t*, p));
+        break;
+
+      case FLD_KIND_INT16:
+        Init_Integer(out, *cast(const int16_t*, p));
+        break;
+
+      case FLD_KIND_UINT32:
+        Init_Integer(out, *cast(const uint32_t*, p));
+        break;
+
+      case FLD_KIND_INT32:
+        Init_Integer(out, *cast(const int32_t*, p));
+        break;
+
+      case FLD_KIND_UINT64:
+        Init_Integer(out, *cast(const uint64_t*, p));
+        break;
+
+      case FLD_KIND_INT64:
+        Init_Integer(out, *cast(const int64_t*, p));
+        break;
+
+      case FLD_KIND_FLOAT:
+        Init_Decimal(out, *cast(const float*, p));
+        break;
+
+      case FLD_KIND_DOUBLE:
+        Init_Decimal(out, *cast(const double*, p));
+        break;
+
+      case FLD_KIND_POINTER:  // !!! Should 0 come back as a NULL to Rebol?
+        Init_Integer(out, cast(intptr_t, *cast(void* const*, p)));
+        break;
+
+      case FLD_KIND_REBVAL:
+        Copy_Cell(out, cast(const REBVAL*, p));
+        break;
+
+      default:
+        assert(false);
+        fail ("Unknown FFI type indicator");
+    }
+}
+
+
 static void get_scalar(
     RELVAL *out,
     REBSTU *stu,
-    REBFLD *field,
+    const struct Reb_Field_Access *a,
     REBLEN n  // element index, starting from 0
 ){
-    assert(n == 0 or FLD_IS_ARRAY(field));
+    assert(n == 0 or a->dimension != 0);
 
-    REBLEN offset =
-        STU_OFFSET(stu) + FLD_OFFSET(field) + (n * FLD_WIDE(field));
+    REBLEN offset = STU_OFFSET(stu) + a->offset + (n * a->wide);
 
-    if (FLD_IS_STRUCT(field)) {
+    if (a->kind == FLD_KIND_STRUCT) {
         //
         // In order for the schema to participate in GC it must be a series.
         // Currently this series is created with a single value of the root
@@ -72,15 +153,16 @@ static void get_scalar(
         REBSTU *sub_stu = Alloc_Singular(
             NODE_FLAG_MANAGED | SERIES_FLAG_LINK_NODE_NEEDS_MARK
         );
-        mutable_LINK(Schema, sub_stu) = field;
+        mutable_LINK(Schema, sub_stu) = a->field;
 
         // The parent data may be a singular array for a HANDLE! or a BINARY!
         // series, depending on whether the data is owned by Rebol or not.
         // That series pointer is being referenced again here.
         //
+        Prepare_Struct_For_View(stu);
         Copy_Cell(ARR_SINGLE(sub_stu), STU_DATA(stu));
         STU_OFFSET(sub_stu) = offset;
-        assert(STU_SIZE(sub_stu) == FLD_WIDE(field));
+        assert(STU_SIZE(sub_stu) == a->wide);
         Init_Struct(out, sub_stu);
         return;
     }
@@ -96,134 +178,575 @@ static void get_scalar(
 
     REBYTE *p = offset + STU_DATA_HEAD(stu);
 
-    switch (FLD_TYPE_SYM(field)) {
-      case SYM_UINT8:
-        Init_Integer(out, *cast(uint8_t*, p));
-        break;
+    Get_Scalar_At(out, p, a->kind);
+}
 
-      case SYM_INT8:
-        Init_Integer(out, *cast(int8_t*, p));
-        break;
 
-      case SYM_UINT16:
-        Init_Integer(out, *cast(uint16_t*, p));
-        break;
+//
+//  Vector_Matches_FFType: C
+//
+// Does each element of a VECTOR! have the same C representation as values of
+// the given FFI type?  Signedness must agree for integers, but any integral
+// vector of the right width is accepted for pointers.
+//
+bool Vector_Matches_FFType(const RELVAL *vec, ffi_type *fftype)
+{
+    if (VAL_VECTOR_WIDE(vec) != fftype->size)
+        return false;
 
-      case SYM_INT16:
-        Init_Integer(out, *cast(int8_t*, p));
-        break;
+    switch (fftype->type) {
+      case FFI_TYPE_FLOAT:
+      case FFI_TYPE_DOUBLE:
+        return not VAL_VECTOR_INTEGRAL(vec);
 
-      case SYM_UINT32:
-        Init_Integer(out, *cast(uint32_t*, p));
-        break;
+      case FFI_TYPE_UINT8:
+      case FFI_TYPE_UINT16:
+      case FFI_TYPE_UINT32:
+      case FFI_TYPE_UINT64:
+        return VAL_VECTOR_INTEGRAL(vec) and not VAL_VECTOR_SIGN(vec);
 
-      case SYM_INT32:
-        Init_Integer(out, *cast(int32_t*, p));
-        break;
+      case FFI_TYPE_SINT8:
+      case FFI_TYPE_SINT16:
+      case FFI_TYPE_SINT32:
+      case FFI_TYPE_SINT64:
+        return VAL_VECTOR_INTEGRAL(vec) and VAL_VECTOR_SIGN(vec);
 
-      case SYM_UINT64:
-        Init_Integer(out, *cast(uint64_t*, p));
-        break;
+      case FFI_TYPE_POINTER:
+        return VAL_VECTOR_INTEGRAL(vec);
 
-      case SYM_INT64:
-        Init_Integer(out, *cast(int64_t*, p));
-        break;
+      default:
+        return false;
+    }
+}
 
-      case SYM_FLOAT:
-        Init_Decimal(out, *cast(float*, p));
-        break;
 
-      case SYM_DOUBLE:
-        Init_Decimal(out, *cast(double*, p));
+//
+//  Make_Vector_For_FFType: C
+//
+// Make a VECTOR! of `len` elements whose C representation is the given FFI
+// type (pointers become unsigned integers of pointer width).  Returns an API
+// handle the caller must release.
+//
+REBVAL *Make_Vector_For_FFType(ffi_type *fftype, REBLEN len)
+{
+    const char *kind;
+    switch (fftype->type) {
+      case FFI_TYPE_FLOAT:
+      case FFI_TYPE_DOUBLE:
+        kind = "decimal!";
         break;
 
-      case SYM_POINTER:  // !!! Should 0 come back as a NULL to Rebol?
-        Init_Integer(out, cast(intptr_t, *cast(void**, p)));
+      case FFI_TYPE_SINT8:
+      case FFI_TYPE_SINT16:
+      case FFI_TYPE_SINT32:
+      case FFI_TYPE_SINT64:
+        kind = "integer!";
         break;
 
-      case SYM_REBVAL:
-        Copy_Cell(out, cast(const REBVAL*, p));
+      case FFI_TYPE_UINT8:
+      case FFI_TYPE_UINT16:
+      case FFI_TYPE_UINT32:
+      case FFI_TYPE_UINT64:
+      case FFI_TYPE_POINTER:
+        kind = "unsigned integer!";
         break;
 
       default:
-        assert(false);
-        fail ("Unknown FFI type indicator");
+        fail ("FFI: No VECTOR! representation for this C type");
     }
+
+    return rebValue(
+        "make vector! [", kind, rebI(fftype->size * 8), rebI(len), "]"
+    );
 }
 
 
 //
-//  Get_Struct_Var: C
+// Arrays of C scalars (besides REBVAL) are exchanged "packed"--as a VECTOR!
+// with elements of the same C type, or a BINARY! for uint8.  Series can't be
+// made to alias memory they don't own, so reading one is a copy...but it is
+// one allocation and a memcpy instead of a boxed cell per element.
 //
-static bool Get_Struct_Var(REBVAL *out, REBSTU *stu, const RELVAL *word)
+static bool Is_Packed_Array_Field(const struct Reb_Field_Access *a) {
+    return a->dimension != 0
+        and a->kind != FLD_KIND_STRUCT
+        and a->kind != FLD_KIND_REBVAL;
+}
+
+static void Get_Packed_Array(
+    REBVAL *out,
+    REBSTU *stu,
+    const struct Reb_Field_Access *a
+){
+    assert(Is_Packed_Array_Field(a));
+    REBLEN size = a->wide * a->dimension;
+
+    if (a->kind == FLD_KIND_UINT8) {
+        REBBIN *bin = Make_Binary(size);
+        memcpy(
+            BIN_HEAD(bin),
+            STU_DATA_HEAD(stu) + STU_OFFSET(stu) + a->offset,
+            size
+        );
+        TERM_BIN_LEN(bin, size);
+        Init_Binary(out, bin);
+        return;
+    }
+
+    REBVAL *vector = Make_Vector_For_FFType(
+        FLD_FFTYPE(a->field),
+        a->dimension
+    );
+    memcpy(  // get data pointer after the evaluation in making the vector
+        VAL_VECTOR_HEAD(vector),
+        STU_DATA_HEAD(stu) + STU_OFFSET(stu) + a->offset,
+        size
+    );
+    Copy_Cell(out, vector);
+    rebRelease(vector);
+}
+
+// Array fields of plain numbers (everything but pointers, REBVALs, and
+// structs) can be converted a chunk at a time by the routines in %c-bulk.c,
+// which dispatch on the kind once per chunk instead of once per element.
+//
+inline static bool Is_Bulk_Kind(enum Reb_Field_Kind kind)
+  { return kind <= FLD_KIND_DOUBLE; }
+
+inline static bool Is_Integral_Kind(enum Reb_Field_Kind kind)
+  { return kind <= FLD_KIND_INT64; }
+
+
+//
+//  Get_Bulk_Array_To_Cells: C
+//
+// Fill `n` cells with INTEGER! or DECIMAL! from the elements at `src`.
+//
+static void Get_Bulk_Array_To_Cells(
+    RELVAL *out,
+    const REBYTE *src,
+    const struct Reb_Field_Access *a,
+    REBLEN n
+){
+    assert(Is_Bulk_Kind(a->kind));
+
+    union {
+        int64_t i[FFI_BULK_CHUNK];
+        double d[FFI_BULK_CHUNK];
+    } buf;
+
+    while (n != 0) {
+        REBLEN chunk = n < FFI_BULK_CHUNK ? n : FFI_BULK_CHUNK;
+        REBLEN k;
+        if (Is_Integral_Kind(a->kind)) {
+            Bulk_Load_Int64(buf.i, src, a->kind, chunk);
+            for (k = 0; k < chunk; ++k, ++out)
+                Init_Integer(out, buf.i[k]);
+        }
+        else {
+            Bulk_Load_Double(buf.d, src, a->kind, chunk);
+            for (k = 0; k < chunk; ++k, ++out)
+                Init_Decimal(out, buf.d[k]);
+        }
+        src += chunk * a->wide;
+        n -= chunk;
+    }
+}
+
+
+//
+//  Set_Bulk_Array_From_Cells: C
+//
+// Store `n` INTEGER! or DECIMAL! cells as elements at `dest`, converting and
+// failing just like assign_scalar() would for each one.
+//
+static void Set_Bulk_Array_From_Cells(
+    REBYTE *dest,
+    const struct Reb_Field_Access *a,
+    const RELVAL *item,
+    REBLEN n
+){
+    assert(Is_Bulk_Kind(a->kind));
+    bool integral = Is_Integral_Kind(a->kind);
+
+    union {
+        int64_t i[FFI_BULK_CHUNK];
+        double d[FFI_BULK_CHUNK];
+    } buf;
+
+    while (n != 0) {
+        REBLEN chunk = n < FFI_BULK_CHUNK ? n : FFI_BULK_CHUNK;
+        REBLEN k;
+        for (k = 0; k < chunk; ++k, ++item) {
+            const REBVAL *v = SPECIFIC(item);
+            if (IS_INTEGER(v)) {
+                if (integral)
+                    buf.i[k] = VAL_INT64(v);
+                else
+                    buf.d[k] = cast(double, VAL_INT64(v));
+            }
+            else if (IS_DECIMAL(v)) {
+                if (integral)
+                    buf.i[k] = cast(int64_t, VAL_DECIMAL(v));
+                else
+                    buf.d[k] = VAL_DECIMAL(v);
+            }
+            else
+                fail (Error_Invalid_Type(VAL_TYPE(v)));
+        }
+
+        if (not integral)
+            Bulk_Store_Double(dest, a->kind, buf.d, chunk);
+        else if (not Bulk_Store_Int64(dest, a->kind, buf.i, chunk))
+            fail (Error_Overflow_Raw());
+
+        dest += chunk * a->wide;
+        n -= chunk;
+    }
+}
+
+
+// The kind of a VECTOR!'s elements, or FLD_KIND_POINTER if it has none.
+//
+static enum Reb_Field_Kind Vector_Kind(const RELVAL *vec)
 {
-    REBARR *fieldlist = STU_FIELDLIST(stu);
+    bool sign = VAL_VECTOR_SIGN(vec);
+    if (not VAL_VECTOR_INTEGRAL(vec)) {
+        switch (VAL_VECTOR_WIDE(vec)) {
+          case 4: return FLD_KIND_FLOAT;
+          case 8: return FLD_KIND_DOUBLE;
+        }
+        return FLD_KIND_POINTER;
+    }
+    switch (VAL_VECTOR_WIDE(vec)) {
+      case 1: return sign ? FLD_KIND_INT8 : FLD_KIND_UINT8;
+      case 2: return sign ? FLD_KIND_INT16 : FLD_KIND_UINT16;
+      case 4: return sign ? FLD_KIND_INT32 : FLD_KIND_UINT32;
+      case 8: return sign ? FLD_KIND_INT64 : FLD_KIND_UINT64;
+    }
+    return FLD_KIND_POINTER;
+}
 
-    RELVAL *tail = ARR_TAIL(fieldlist);
-    RELVAL *item = ARR_HEAD(fieldlist);
-    for (; item != tail; ++item) {
-        REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(item);
-        if (FLD_NAME(field) != VAL_WORD_SYMBOL(word))
-            continue;
 
-        if (FLD_IS_ARRAY(field)) {
-            //
-            // Structs contain packed data for the field type in an array.
-            // This data cannot expand or contract, and is not in a
-            // Rebol-compatible format.  A Rebol Array is made by
-            // extracting the information.
-            //
-            // !!! Perhaps a fixed-size VECTOR! could have its data
-            // pointer into these arrays?
-            //
-            REBLEN dimension = FLD_DIMENSION(field);
-            REBARR *arr = Make_Array(dimension);
-            REBLEN n;
-            for (n = 0; n < dimension; ++n)
-                get_scalar(ARR_AT(arr, n), stu, field, n);
-            SET_SERIES_LEN(arr, dimension);
-            Init_Block(out, arr);
+//
+//  Set_Bulk_Array_From_Vector: C
+//
+// A VECTOR! whose elements are a different C type than the field's (e.g. an
+// `integer! 32` vector for a `[int16 [N]]` field) is converted, narrowing
+// with range checks or converting between float and double.  Integers and
+// floating point aren't mixed: returns false for that (or for fields that
+// aren't plain numbers), leaving the field untouched.
+//
+static bool Set_Bulk_Array_From_Vector(
+    REBYTE *dest,
+    const struct Reb_Field_Access *a,
+    const REBVAL *vec
+){
+    enum Reb_Field_Kind from = Vector_Kind(vec);
+    if (not Is_Bulk_Kind(a->kind) or not Is_Bulk_Kind(from))
+        return false;
+    if (Is_Integral_Kind(a->kind) != Is_Integral_Kind(from))
+        return false;
+
+    const REBYTE *src = cast(const REBYTE*, VAL_VECTOR_HEAD(vec));
+    REBLEN wide = VAL_VECTOR_WIDE(vec);
+
+    REBLEN n = a->dimension;
+    if (not Is_Integral_Kind(from)) {
+        double buf[FFI_BULK_CHUNK];
+        while (n != 0) {
+            REBLEN chunk = n < FFI_BULK_CHUNK ? n : FFI_BULK_CHUNK;
+            Bulk_Load_Double(buf, src, from, chunk);
+            Bulk_Store_Double(dest, a->kind, buf, chunk);
+            src += chunk * wide;
+            dest += chunk * a->wide;
+            n -= chunk;
         }
-        else
-            get_scalar(out, stu, field, 0);
+        return true;
+    }
+
+    int64_t buf[FFI_BULK_CHUNK];
+    while (n != 0) {
+        REBLEN chunk = n < FFI_BULK_CHUNK ? n : FFI_BULK_CHUNK;
+        Bulk_Load_Int64(buf, src, from, chunk);
+        if (not Bulk_Store_Int64(dest, a->kind, buf, chunk))
+            fail (Error_Overflow_Raw());  // like a BLOCK!, may be partial
+        src += chunk * wide;
+        dest += chunk * a->wide;
+        n -= chunk;
+    }
+    return true;
+}
+
 
+// Accepts a VECTOR! of the same dimension, or a BINARY! with just the right
+// number of bytes.  A vector of the same C type is copied directly, others
+// are converted (see Set_Bulk_Array_From_Vector()).
+//
+static bool Set_Packed_Array(
+    REBYTE *dest,
+    const struct Reb_Field_Access *a,
+    const REBVAL *val
+){
+    assert(Is_Packed_Array_Field(a));
+    REBLEN size = a->wide * a->dimension;
+
+    if (IS_BINARY(val)) {
+        REBSIZ bin_size;
+        const REBYTE *bin_at = VAL_BYTES_AT(&bin_size, val);
+        if (bin_size != size)
+            return false;
+        memmove(dest, bin_at, size);
         return true;
     }
 
-    return false; // word not found in struct's field symbols
+    if (IS_VECTOR(val)) {
+        if (VAL_VECTOR_LEN_AT(val) != a->dimension)
+            return false;
+        if (Vector_Matches_FFType(val, FLD_FFTYPE(a->field))) {
+            memmove(dest, VAL_VECTOR_HEAD(val), size);
+            return true;
+        }
+        return Set_Bulk_Array_From_Vector(dest, a, val);
+    }
+
+    return false;
+}
+
+
+static enum Reb_Field_Kind Field_Kind_For_Sym(SYMID sym)
+{
+    switch (sym) {
+      case SYM_UINT8: return FLD_KIND_UINT8;
+      case SYM_INT8: return FLD_KIND_INT8;
+      case SYM_UINT16: return FLD_KIND_UINT16;
+      case SYM_INT16: return FLD_KIND_INT16;
+      case SYM_UINT32: return FLD_KIND_UINT32;
+      case SYM_INT32: return FLD_KIND_INT32;
+      case SYM_UINT64: return FLD_KIND_UINT64;
+      case SYM_INT64: return FLD_KIND_INT64;
+      case SYM_FLOAT: return FLD_KIND_FLOAT;
+      case SYM_DOUBLE: return FLD_KIND_DOUBLE;
+      case SYM_POINTER: return FLD_KIND_POINTER;
+      case SYM_REBVAL: return FLD_KIND_REBVAL;
+
+      default:
+        panic ("Unknown FFI type indicator");
+    }
+}
+
+
+//
+//  Init_Field_Access: C
+//
+// Unbox what get_scalar() and assign_scalar() need from a field whose type,
+// dimension, offset, and width have been filled in.
+//
+static void Init_Field_Access(struct Reb_Field_Access *a, REBFLD *field)
+{
+    a->field = field;
+    a->offset = FLD_OFFSET(field);
+    a->wide = FLD_WIDE(field);
+    a->dimension = FLD_IS_ARRAY(field) ? FLD_DIMENSION(field) : 0;
+    a->kind = FLD_IS_STRUCT(field)
+        ? FLD_KIND_STRUCT
+        : Field_Kind_For_Sym(FLD_TYPE_SYM(field));
+}
+
+
+// Struct schemas mirroring C headers can have a hundred fields, and every
+// path pick like `s/field` has to find one of them by name.  Rather than
+// walking the fieldlist (where each field is its own array), each struct
+// schema gets an open-addressed table from the symbol of a field name to its
+// position in the fieldlist.  Names are compared by symbol identity, just as
+// the linear search did.
+//
+// The same allocation holds the Reb_Field_Access of every field, in the
+// order of the fieldlist, so a successful lookup is all a path needs.
+//
+struct Reb_Field_Index_Slot {
+    const REBSTR *symbol;  // nullptr if slot is empty
+    REBLEN index;  // 0-based position in the fieldlist
+};
+
+struct Reb_Field_Index {
+    REBLEN mask;  // number of slots minus one (slot count is a power of 2)
+    struct Reb_Field_Access *fields;  // one per field, after the slots
+    struct Reb_Field_Index_Slot slots[1];  // actually mask + 1 slots
+};
+
+inline static REBLEN Hash_Field_Symbol(const REBSTR *symbol) {
+    uintptr_t u = cast(uintptr_t, symbol) >> 4;  // low bits are alignment
+    u ^= u >> 9;
+    return cast(REBLEN, u * 0x9E3779B1u);  // odd multiplier spreads bits
+}
+
+static void cleanup_field_index(const REBVAL *v) {
+    FREE_N(REBYTE, VAL_HANDLE_LEN(v), VAL_HANDLE_POINTER(REBYTE, v));
+}
+
+
+//
+//  Init_Field_Index: C
+//
+// Build the name lookup table for a struct schema whose fieldlist is final.
+//
+static void Init_Field_Index(REBFLD *schema)
+{
+    REBARR *fieldlist = FLD_FIELDLIST(schema);
+    REBLEN num_fields = ARR_LEN(fieldlist);
+
+    REBLEN num_slots = 4;
+    while (num_slots < num_fields * 2)  // keep load factor at most 1/2
+        num_slots *= 2;
+
+    // (The slots hold pointers, so the accesses after them are aligned.)
+    //
+    REBLEN slots_size = sizeof(struct Reb_Field_Index)
+        + (num_slots - 1) * sizeof(struct Reb_Field_Index_Slot);
+    REBLEN size = slots_size + num_fields * sizeof(struct Reb_Field_Access);
+
+    struct Reb_Field_Index *index = cast(
+        struct Reb_Field_Index*, TRY_ALLOC_N(REBYTE, size)
+    );
+    if (index == nullptr)
+        fail (Error_No_Memory(size));
+    index->mask = num_slots - 1;
+    index->fields = cast(
+        struct Reb_Field_Access*, cast(REBYTE*, index) + slots_size
+    );
+
+    REBLEN n;
+    for (n = 0; n < num_slots; ++n)
+        index->slots[n].symbol = nullptr;
+
+    for (n = 0; n < num_fields; ++n) {
+        REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(ARR_AT(fieldlist, n));
+        Init_Field_Access(&index->fields[n], field);
+
+        const REBSTR *symbol = FLD_NAME(field);
+
+        REBLEN slot = Hash_Field_Symbol(symbol) & index->mask;
+        while (index->slots[slot].symbol != nullptr) {
+            if (index->slots[slot].symbol == symbol)
+                goto next_field;  // duplicate name, first one wins
+            slot = (slot + 1) & index->mask;
+        }
+        index->slots[slot].symbol = symbol;
+        index->slots[slot].index = n;
+
+      next_field:
+        continue;
+    }
+
+    Init_Handle_Cdata_Managed(
+        FLD_AT(schema, IDX_FIELD_INDEX),
+        index,
+        size,
+        &cleanup_field_index
+    );
+}
+
+
+// Every struct schema is interned (and so indexed) before any STRUCT! can
+// be made with it.
+//
+inline static const struct Reb_Field_Index *Schema_Index(REBFLD *schema) {
+    assert(IS_HANDLE(FLD_AT(schema, IDX_FIELD_INDEX)));
+    return VAL_HANDLE_POINTER(
+        struct Reb_Field_Index, FLD_AT(schema, IDX_FIELD_INDEX)
+    );
+}
+
+
+//
+//  Find_Struct_Field: C
+//
+// Get the field of a struct schema with a given name, or nullptr.
+//
+static const struct Reb_Field_Access *Find_Struct_Field(
+    REBFLD *schema,
+    const REBSTR *symbol
+){
+    const struct Reb_Field_Index *index = Schema_Index(schema);
+
+    REBLEN slot = Hash_Field_Symbol(symbol) & index->mask;
+    while (index->slots[slot].symbol != nullptr) {
+        if (index->slots[slot].symbol == symbol)
+            return &index->fields[index->slots[slot].index];
+        slot = (slot + 1) & index->mask;
+    }
+    return nullptr;
+}
+
+
+//
+//  Get_Struct_Var: C
+//
+static bool Get_Struct_Var(REBVAL *out, REBSTU *stu, const RELVAL *word)
+{
+    const struct Reb_Field_Access *a = Find_Struct_Field(
+        STU_SCHEMA(stu),
+        VAL_WORD_SYMBOL(word)
+    );
+    if (not a)
+        return false;  // word not found in struct's field symbols
+
+    if (Is_Packed_Array_Field(a) and not STU_INACCESSIBLE(stu))
+        Get_Packed_Array(out, stu, a);
+    else if (a->dimension != 0) {
+        //
+        // Structs contain packed data for the field type in an array.
+        // This data cannot expand or contract, and is not in a
+        // Rebol-compatible format.  A Rebol Array is made by
+        // extracting the information.
+        //
+        REBLEN dimension = a->dimension;
+        REBARR *arr = Make_Array(dimension);
+        REBLEN n;
+        for (n = 0; n < dimension; ++n)
+            get_scalar(ARR_AT(arr, n), stu, a, n);
+        SET_SERIES_LEN(arr, dimension);
+        Init_Block(out, arr);
+    }
+    else
+        get_scalar(out, stu, a, 0);
+
+    return true;
 }
 
 
 //
 //  Struct_To_Array: C
 //
-// Used by MOLD to create a block.
+// Used by SPEC OF to create a block.  (MOLD streams the same shape of block
+// without making it, see MF_Struct().)
 //
 // Cannot fail(), because fail() could call MOLD on a struct!, which will end
 // up infinitive recursive calls.
 //
 REBARR *Struct_To_Array(REBSTU *stu)
 {
-    REBARR *fieldlist = STU_FIELDLIST(stu);
-    RELVAL *item = ARR_HEAD(fieldlist);
-    RELVAL *tail = ARR_TAIL(fieldlist);
+    REBLEN num_fields = ARR_LEN(STU_FIELDLIST(stu));
+    const struct Reb_Field_Access *a = Schema_Index(STU_SCHEMA(stu))->fields;
+    const struct Reb_Field_Access *a_tail = a + num_fields;
 
     REBDSP dsp_orig = DSP;
 
     // fail_if_non_accessible(STU_TO_VAL(stu));
 
-    for(; item != tail; ++item) {
-        REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(item);
+    for(; a != a_tail; ++a) {
+        REBFLD *field = a->field;
 
         Init_Set_Word(DS_PUSH(), FLD_NAME(field)); // required name
 
         REBARR *typespec = Make_Array(2); // required type
 
-        if (FLD_IS_STRUCT(field)) {
+        if (a->kind == FLD_KIND_STRUCT) {
             Init_Word(Alloc_Tail_Array(typespec), Canon(SYM_STRUCT_X));
 
             DECLARE_LOCAL (nested);
-            get_scalar(nested, stu, field, 0);
+            get_scalar(nested, stu, a, 0);
 
             PUSH_GC_GUARD(nested); // is this guard still necessary?
             Init_Block(
@@ -243,11 +766,11 @@ REBARR *Struct_To_Array(REBSTU *stu)
         // !!! Comment said the initialization was optional, but it seems
         // that the initialization always happens (?)
         //
-        if (FLD_IS_ARRAY(field)) {
+        if (a->dimension != 0) {
             //
             // Dimension becomes INTEGER! in a BLOCK! (to look like a C array)
             //
-            REBLEN dimension = FLD_DIMENSION(field);
+            REBLEN dimension = a->dimension;
             REBARR *one_int = Alloc_Singular(NODE_FLAG_MANAGED);
             Init_Integer(ARR_SINGLE(one_int), dimension);
             Init_Block(Alloc_Tail_Array(typespec), one_int);
@@ -255,14 +778,23 @@ REBARR *Struct_To_Array(REBSTU *stu)
             // Initialization seems to be just another block after that (?)
             //
             REBARR *init = Make_Array(dimension);
-            REBLEN n;
-            for (n = 0; n < dimension; n ++)
-                get_scalar(ARR_AT(init, n), stu, field, n);
+            if (Is_Bulk_Kind(a->kind) and not STU_INACCESSIBLE(stu))
+                Get_Bulk_Array_To_Cells(
+                    ARR_HEAD(init),
+                    STU_DATA_HEAD(stu) + STU_OFFSET(stu) + a->offset,
+                    a,
+                    dimension
+                );
+            else {
+                REBLEN n;
+                for (n = 0; n < dimension; n ++)
+                    get_scalar(ARR_AT(init, n), stu, a, n);
+            }
             SET_SERIES_LEN(init, dimension);
             Init_Block(Alloc_Tail_Array(typespec), init);
         }
         else
-            get_scalar(Alloc_Tail_Array(typespec), stu, field, 0);
+            get_scalar(Alloc_Tail_Array(typespec), stu, a, 0);
 
         Init_Block(DS_PUSH(), typespec); // required type
     }
@@ -271,15 +803,213 @@ REBARR *Struct_To_Array(REBSTU *stu)
 }
 
 
+//=//// STREAMING MOLD /////////////////////////////////////////////////////=//
+//
+// Molding a struct writes straight from the field descriptors into the mold
+// buffer, instead of building the block Struct_To_Array() would give and
+// molding that.  Otherwise a big array field would box every element, even
+// when MOLD/LIMIT is only going to keep the first few.
+//
+// An array of uint8 molds as a BINARY!.  In other arrays, a run of the same
+// element is shown once followed by e.g. `<repeats 60 times>` (as gdb does).
+//
+
+#define FFI_MOLD_REPEATS_MIN 8  // shorter runs don't save anything
+
+// Once a MOLD/LIMIT is reached, the rest of the struct can be skipped.  (The
+// core trims what's past the limit and adds the `...`)
+//
+static bool Struct_Mold_Limit_Hit(REB_MOLD *mo) {
+    return GET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT)
+        and STR_LEN(mo->series) - mo->base.index >= mo->limit;
+}
+
+static void Mold_Struct_Data(
+    REB_MOLD *mo,
+    REBFLD *schema,
+    const REBYTE *data  // nullptr if inaccessible
+);
+
+// How many elements starting at `p`, `stride` bytes apart, have the same
+// `size` bytes?
+//
+static REBLEN Struct_Mold_Run(
+    const REBYTE *p,
+    REBLEN size,
+    REBLEN stride,
+    REBLEN max
+){
+    REBLEN run = 1;
+    while (run < max and memcmp(p, p + run * stride, size) == 0)
+        ++run;
+    return run;
+}
+
+static void Mold_Struct_Repeats(REB_MOLD *mo, REBLEN run)
+{
+    Append_Ascii(mo->series, " <repeats ");
+    Append_Int(mo->series, run);
+    Append_Ascii(mo->series, " times>");
+}
+
+static void Mold_Bytes_Field(REB_MOLD *mo, const REBYTE *p, REBLEN len)
+{
+    const char *hex = "0123456789ABCDEF";
+
+    Append_Ascii(mo->series, "#{");
+    REBLEN n;
+    for (n = 0; n < len; ++n) {
+        if (Struct_Mold_Limit_Hit(mo))
+            return;
+        Append_Codepoint(mo->series, hex[p[n] >> 4]);
+        Append_Codepoint(mo->series, hex[p[n] & 0xF]);
+    }
+    Append_Codepoint(mo->series, '}');
+}
+
+static void Mold_Array_Field(
+    REB_MOLD *mo,
+    const struct Reb_Field_Access *a,
+    const REBYTE *p  // first element
+){
+    if (a->kind == FLD_KIND_UINT8) {
+        Mold_Bytes_Field(mo, p, a->dimension);
+        return;
+    }
+
+    DECLARE_LOCAL (cell);
+
+    Append_Codepoint(mo->series, '[');
+    REBLEN n = 0;
+    while (n < a->dimension) {
+        if (Struct_Mold_Limit_Hit(mo))
+            return;
+
+        if (n != 0)
+            Append_Codepoint(mo->series, ' ');
+
+        const REBYTE *elem = p + n * a->wide;
+        if (a->kind == FLD_KIND_STRUCT)
+            Mold_Struct_Data(mo, a->field, elem);
+        else {
+            Get_Scalar_At(cell, elem, a->kind);
+            Mold_Value(mo, cell);
+        }
+
+        REBLEN run = Struct_Mold_Run(
+            elem, a->wide, a->wide, a->dimension - n
+        );
+        if (run < FFI_MOLD_REPEATS_MIN)
+            ++n;
+        else {
+            Mold_Struct_Repeats(mo, run);
+            n += run;
+        }
+    }
+    Append_Codepoint(mo->series, ']');
+}
+
+// Mold the fields of `schema` as `[name: [type value] ...]`, like the block
+// Struct_To_Array() makes (only with arrays compressed as above).
+//
+static void Mold_Struct_Data(
+    REB_MOLD *mo,
+    REBFLD *schema,
+    const REBYTE *data
+){
+    REBLEN num_fields = ARR_LEN(FLD_FIELDLIST(schema));
+    const struct Reb_Field_Access *a_head = Schema_Index(schema)->fields;
+    const struct Reb_Field_Access *a_tail = a_head + num_fields;
+    const struct Reb_Field_Access *a = a_head;
+
+    DECLARE_LOCAL (cell);
+
+    Append_Codepoint(mo->series, '[');
+    for (; a != a_tail; ++a) {
+        if (Struct_Mold_Limit_Hit(mo))
+            return;
+
+        if (a != a_head)
+            Append_Codepoint(mo->series, ' ');
+
+        REBFLD *field = a->field;
+        Append_Spelling(mo->series, FLD_NAME(field));
+        Append_Ascii(mo->series, ": [");
+
+        if (a->kind == FLD_KIND_STRUCT) {
+            Append_Ascii(mo->series, "struct! ");
+            Mold_Struct_Data(mo, field, data ? data + a->offset : nullptr);
+        }
+        else
+            Append_Spelling(mo->series, Canon(FLD_TYPE_SYM(field)));
+
+        if (a->dimension != 0) {
+            Append_Ascii(mo->series, " [");
+            Append_Int(mo->series, a->dimension);
+            Append_Codepoint(mo->series, ']');
+        }
+
+        if (data == nullptr) {
+            // no values to show
+        }
+        else if (a->dimension != 0) {
+            Append_Codepoint(mo->series, ' ');
+            Mold_Array_Field(mo, a, data + a->offset);
+        }
+        else if (a->kind != FLD_KIND_STRUCT) {
+            Append_Codepoint(mo->series, ' ');
+            Get_Scalar_At(cell, data + a->offset, a->kind);
+            Mold_Value(mo, cell);
+        }
+
+        Append_Codepoint(mo->series, ']');
+    }
+    Append_Codepoint(mo->series, ']');
+}
+
+
 void MF_Struct(REB_MOLD *mo, REBCEL(const*) v, bool form)
 {
     UNUSED(form);
 
     Pre_Mold(mo, v);
 
-    REBARR *array = Struct_To_Array(VAL_STRUCT(v));
-    Mold_Array_At(mo, array, 0, "[]");
-    Free_Unmanaged_Series(array);
+    REBSTU *stu = VAL_STRUCT(v);
+    const REBYTE *data = STU_INACCESSIBLE(stu)
+        ? nullptr
+        : STU_DATA_HEAD(stu) + STU_OFFSET(stu);
+
+    if (not STU_IS_ARRAY(stu))
+        Mold_Struct_Data(mo, STU_SCHEMA(stu), data);
+    else {
+        // A struct array molds as a block of its elements' field blocks.
+        //
+        REBFLD *elem_schema = STU_ELEMENT_SCHEMA(stu);
+        REBLEN size = FLD_WIDE(elem_schema);
+        REBLEN stride = STU_ARRAY_STRIDE(stu);
+        REBLEN len = STU_ARRAY_LEN(stu);
+
+        Append_Codepoint(mo->series, '[');
+        REBLEN n = 0;
+        while (n < len and not Struct_Mold_Limit_Hit(mo)) {
+            if (n != 0)
+                Append_Codepoint(mo->series, ' ');
+
+            const REBYTE *elem = data ? data + n * stride : nullptr;
+            Mold_Struct_Data(mo, elem_schema, elem);
+
+            REBLEN run = elem
+                ? Struct_Mold_Run(elem, size, stride, len - n)
+                : 1;
+            if (run < FFI_MOLD_REPEATS_MIN)
+                ++n;
+            else {
+                Mold_Struct_Repeats(mo, run);
+                n += run;
+            }
+        }
+        Append_Codepoint(mo->series, ']');
+    }
 
     End_Mold(mo);
 }
@@ -287,6 +1017,9 @@ void MF_Struct(REB_MOLD *mo, REBCEL(const*) v, bool form)
 
 static bool same_fields(REBARR *tgt_fieldlist, REBARR *src_fieldlist)
 {
+    if (tgt_fieldlist == src_fieldlist)
+        return true;  // common case, since schemas are interned
+
     if (ARR_LEN(tgt_fieldlist) != ARR_LEN(src_fieldlist))
         return false;
 
@@ -337,26 +1070,29 @@ static bool same_fields(REBARR *tgt_fieldlist, REBARR *src_fieldlist)
 static bool assign_scalar_core(
     REBYTE *data_head,
     REBLEN offset,
-    REBFLD *field,
+    const struct Reb_Field_Access *a,
     REBLEN n,
     const REBVAL *val
 ){
-    assert(n == 0 or FLD_IS_ARRAY(field));
+    assert(n == 0 or a->dimension != 0);
 
-    void *data = data_head +
-        offset + FLD_OFFSET(field) + (n * FLD_WIDE(field));
+    void *data = data_head + offset + a->offset + (n * a->wide);
 
-    if (FLD_IS_STRUCT(field)) {
+    if (a->kind == FLD_KIND_STRUCT) {
         if (not IS_STRUCT(val))
             fail (Error_Invalid_Type(VAL_TYPE(val)));
 
-        if (FLD_WIDE(field) != VAL_STRUCT_SIZE(val))
+        if (a->wide != VAL_STRUCT_SIZE(val))
             fail (val);
 
-        if (not same_fields(FLD_FIELDLIST(field), VAL_STRUCT_FIELDLIST(val)))
+        if (not same_fields(
+            FLD_FIELDLIST(a->field),
+            VAL_STRUCT_FIELDLIST(val)
+        )){
             fail (val);
+        }
 
-        memcpy(data, VAL_STRUCT_DATA_AT(val), FLD_WIDE(field));
+        memcpy(data, VAL_STRUCT_DATA_AT(val), a->wide);
 
         return true;
     }
@@ -383,7 +1119,7 @@ static bool assign_scalar_core(
         // same code is used to process FFI function arguments and struct
         // definitions, and the feature may be useful for function args.
 
-        if (FLD_TYPE_SYM(field) != SYM_REBVAL)
+        if (a->kind != FLD_KIND_REBVAL)
             fail (Error_Invalid_Type(VAL_TYPE(val)));
 
         // Avoid uninitialized variable warnings (should not be used)
@@ -392,69 +1128,69 @@ static bool assign_scalar_core(
         d = 304;
     }
 
-    switch (FLD_TYPE_SYM(field)) {
-      case SYM_INT8:
+    switch (a->kind) {
+      case FLD_KIND_INT8:
         if (i > 0x7f or i < -128)
             fail (Error_Overflow_Raw());
         *cast(int8_t*, data) = cast(int8_t, i);
         break;
 
-      case SYM_UINT8:
+      case FLD_KIND_UINT8:
         if (i > 0xff or i < 0)
             fail (Error_Overflow_Raw());
         *cast(uint8_t*, data) = cast(uint8_t, i);
         break;
 
-      case SYM_INT16:
+      case FLD_KIND_INT16:
         if (i > 0x7fff or i < -0x8000)
             fail (Error_Overflow_Raw());
         *cast(int16_t*, data) = cast(int16_t, i);
         break;
 
-      case SYM_UINT16:
+      case FLD_KIND_UINT16:
         if (i > 0xffff or i < 0)
             fail (Error_Overflow_Raw());
         *cast(uint16_t*, data) = cast(uint16_t, i);
         break;
 
-      case SYM_INT32:
+      case FLD_KIND_INT32:
         if (i > INT32_MAX or i < INT32_MIN)
             fail (Error_Overflow_Raw());
         *cast(int32_t*, data) = cast(int32_t, i);
         break;
 
-      case SYM_UINT32:
+      case FLD_KIND_UINT32:
         if (i > UINT32_MAX or i < 0)
             fail (Error_Overflow_Raw());
         *cast(uint32_t*, data) = cast(uint32_t, i);
         break;
 
-      case SYM_INT64:
+      case FLD_KIND_INT64:
         *cast(int64_t*, data) = i;
         break;
 
-      case SYM_UINT64:
+      case FLD_KIND_UINT64:
         if (i < 0)
             fail (Error_Overflow_Raw());
         *cast(uint64_t*, data) = cast(uint64_t, i);
         break;
 
-      case SYM_FLOAT:
+      case FLD_KIND_FLOAT:
         *cast(float*, data) = cast(float, d);
         break;
 
-      case SYM_DOUBLE:
+      case FLD_KIND_DOUBLE:
         *cast(double*, data) = d;
         break;
 
-      case SYM_POINTER: {
+      case FLD_KIND_POINTER: {
         size_t sizeof_void_ptr = sizeof(void*); // avoid constant conditional
         if (sizeof_void_ptr == 4 and i > UINT32_MAX)
             fail (Error_Overflow_Raw());
         *cast(void**, data) = cast(void*, cast(intptr_t, i));
         break; }
 
-      case SYM_REBVAL:
+      case FLD_KIND_REBVAL:
         //
         // !!! This is a dangerous thing to be doing in generic structs, but
         // for the main purpose of REBVAL (tunneling) it should be okay so
@@ -465,7 +1201,7 @@ static bool assign_scalar_core(
         break;
 
       default:
-        assert(not "unknown FLD_TYPE_SYM()");
+        assert(not "unknown field kind");
         return false;
     }
 
@@ -475,16 +1211,64 @@ static bool assign_scalar_core(
 
 inline static bool assign_scalar(
     REBSTU *stu,
-    REBFLD *field,
+    const struct Reb_Field_Access *a,
     REBLEN n,
     const REBVAL *val
 ){
     return assign_scalar_core(
-        STU_DATA_HEAD(stu), STU_OFFSET(stu), field, n, val
+        STU_DATA_HEAD(stu), STU_OFFSET(stu), a, n, val
     );
 }
 
 
+// Raw pointer access has no field to go through, so it gets a stand-in one
+// for a scalar at offset zero.
+//
+static void Init_Pointer_Access(struct Reb_Field_Access *a, SYMID sym)
+{
+    ffi_type *fftype = Get_FFType_For_Sym(sym);
+    if (fftype == nullptr or sym == SYM_REBVAL)
+        fail ("FFI: Pointer access needs a C scalar type, e.g. int32");
+
+    a->field = nullptr;
+    a->offset = 0;
+    a->wide = fftype->size;
+    a->dimension = 0;
+    a->kind = Field_Kind_For_Sym(sym);
+}
+
+
+//
+//  Peek_Scalar_At: C
+//
+// Read the C scalar of FFI type `sym` (e.g. SYM_INT32) at `p`, the way a
+// struct field of that type would be read, but without a struct.
+//
+REBVAL *Peek_Scalar_At(REBVAL *out, const void *p, SYMID sym)
+{
+    struct Reb_Field_Access a;
+    Init_Pointer_Access(&a, sym);
+
+    Get_Scalar_At(out, cast(const REBYTE*, p), a.kind);
+    return out;
+}
+
+
+//
+//  Poke_Scalar_At: C
+//
+// Write `val` at `p` as a C scalar of FFI type `sym`, range checking as an
+// assignment to a struct field of that type would.
+//
+void Poke_Scalar_At(void *p, SYMID sym, const REBVAL *val)
+{
+    struct Reb_Field_Access a;
+    Init_Pointer_Access(&a, sym);
+
+    assign_scalar_core(cast(REBYTE*, p), 0, &a, 0, val);
+}
+
+
 //
 //  Set_Struct_Var: C
 //
@@ -494,47 +1278,250 @@ static bool Set_Struct_Var(
     const REBVAL *elem,
     const REBVAL *val
 ){
-    REBARR *fieldlist = STU_FIELDLIST(stu);
-    RELVAL *item = ARR_HEAD(fieldlist);
-    RELVAL *tail = ARR_TAIL(fieldlist);
+    const struct Reb_Field_Access *a = Find_Struct_Field(
+        STU_SCHEMA(stu),
+        VAL_WORD_SYMBOL(word)
+    );
+    if (not a)
+        return false;
 
-    for (; item != tail; ++item) {
-        REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(item);
+    Prepare_Struct_For_Write(stu);
+
+    if (a->dimension != 0) {
+        if (elem == nullptr) { // set the whole array
+            if (
+                Is_Packed_Array_Field(a)
+                and (IS_VECTOR(val) or IS_BINARY(val))
+            ){
+                return Set_Packed_Array(
+                    STU_DATA_HEAD(stu) + STU_OFFSET(stu) + a->offset,
+                    a,
+                    val
+                );
+            }
 
-        if (VAL_WORD_SYMBOL(word) != FLD_NAME(field))
-            continue;
+            if (not IS_BLOCK(val))
+                return false;
 
-        if (FLD_IS_ARRAY(field)) {
-            if (elem == nullptr) { // set the whole array
-                if (not IS_BLOCK(val))
-                    return false;
+            REBLEN dimension = a->dimension;
+            if (dimension != VAL_LEN_AT(val))
+                return false;
 
-                REBLEN dimension = FLD_DIMENSION(field);
-                if (dimension != VAL_LEN_AT(val))
-                    return false;
+            if (Is_Bulk_Kind(a->kind)) {
+                Set_Bulk_Array_From_Cells(
+                    STU_DATA_HEAD(stu) + STU_OFFSET(stu) + a->offset,
+                    a,
+                    VAL_ARRAY_AT_HEAD(val, 0),
+                    dimension
+                );
+                return true;
+            }
 
-                REBLEN n = 0;
-                for(n = 0; n < dimension; ++n) {
-                    if (not assign_scalar(
-                        stu, field, n, SPECIFIC(VAL_ARRAY_AT_HEAD(val, n))
-                    )) {
-                        return false;
-                    }
+            REBLEN n = 0;
+            for(n = 0; n < dimension; ++n) {
+                if (not assign_scalar(
+                    stu, a, n, SPECIFIC(VAL_ARRAY_AT_HEAD(val, n))
+                )) {
+                    return false;
                 }
             }
-            else { // set only one element
-                if (not IS_INTEGER(elem) or VAL_INT32(elem) != 1)
-                    return false;
+        }
+        else { // set only one element
+            if (not IS_INTEGER(elem) or VAL_INT32(elem) != 1)
+                return false;
 
-                return assign_scalar(stu, field, 0, val);
-            }
-            return true;
+            return assign_scalar(stu, a, 0, val);
         }
+        return true;
+    }
+
+    return assign_scalar(stu, a, 0, val);
+}
+
+
+//=//// PINNED STORAGE ////////////////////////////////////////////////////=//
+//
+// A BINARY!-backed struct's data may move if the binary is ever expanded,
+// so ADDR-OF on one is only reliably stable by accident.  `[pinned: N]`
+// asks for the data to be allocated at an address that never changes, with
+// an alignment of N bytes (up to a cache line).  As with external storage,
+// the data is held by a managed HANDLE!--but here the HANDLE!'s cleanup
+// gives the memory back when the struct is GC'd.
+//
+// Small sizes are carved out of slabs by size class, so lots of little
+// C-facing structs don't each cost a malloc().  The cleanup function that
+// goes with each class tells which free list a block goes back to.  Slabs
+// are never given back to the system, so the arena stays as big as the
+// largest number of pinned structs alive at once.
+//
+
+#define FFI_PINNED_MAX_ALIGN 64  // a cache line on most current machines
+#define FFI_PINNED_SLAB_SIZE (64 * 1024)
+#define FFI_PINNED_NUM_CLASSES 8  // 16, 32, 64 ... 2048 bytes
+
+#define PINNED_CLASS_SIZE(n) \
+    (cast(REBLEN, 16) << (n))
+
+struct Reb_Pinned_Class {
+    REBYTE *free;  // first free block, whose first bytes link to the next
+    REBYTE *slab_next;  // uncarved part of the newest slab (or nullptr)
+    REBYTE *slab_end;
+};
+
+static struct Reb_Pinned_Class Pinned_Classes[FFI_PINNED_NUM_CLASSES];
+static REBYTE *Pinned_Slabs = nullptr;  // linked through their first bytes
+static bool Pinned_Shutdown = false;  // slabs freed, blocks can't go back
+
+static void Free_Pinned_Block(REBLEN n, REBYTE *block) {
+    if (Pinned_Shutdown)
+        return;
+    memcpy(block, &Pinned_Classes[n].free, sizeof(REBYTE*));
+    Pinned_Classes[n].free = block;
+}
+
+#define DEFINE_PINNED_CLEANER(n) \
+    static void cleanup_pinned_##n(const REBVAL *v) \
+        { Free_Pinned_Block(n, VAL_HANDLE_POINTER(REBYTE, v)); }
+
+DEFINE_PINNED_CLEANER(0)
+DEFINE_PINNED_CLEANER(1)
+DEFINE_PINNED_CLEANER(2)
+DEFINE_PINNED_CLEANER(3)
+DEFINE_PINNED_CLEANER(4)
+DEFINE_PINNED_CLEANER(5)
+DEFINE_PINNED_CLEANER(6)
+DEFINE_PINNED_CLEANER(7)
+
+static CLEANUP_CFUNC *Pinned_Cleaners[FFI_PINNED_NUM_CLASSES] = {
+    &cleanup_pinned_0, &cleanup_pinned_1, &cleanup_pinned_2,
+    &cleanup_pinned_3, &cleanup_pinned_4, &cleanup_pinned_5,
+    &cleanup_pinned_6, &cleanup_pinned_7
+};
+
+// Bigger structs get their own allocation, with the pointer malloc() gave
+// back stashed just before the aligned data.
+//
+static void cleanup_pinned_large(const REBVAL *v) {
+    REBYTE *data = VAL_HANDLE_POINTER(REBYTE, v);
+    void *unaligned;
+    memcpy(&unaligned, data - sizeof(void*), sizeof(void*));
+    free(unaligned);
+}
+
+
+static REBYTE *Alloc_Pinned_Block(REBLEN n)
+{
+    Pinned_Shutdown = false;  // in case the extension is loaded again
+
+    struct Reb_Pinned_Class *c = &Pinned_Classes[n];
+    REBLEN size = PINNED_CLASS_SIZE(n);
+
+    if (c->free) {
+        REBYTE *block = c->free;
+        memcpy(&c->free, block, sizeof(REBYTE*));
+        return block;
+    }
+
+    if (c->slab_next == nullptr or c->slab_next + size > c->slab_end) {
+        REBYTE *slab = cast(REBYTE*, malloc(
+            FFI_PINNED_SLAB_SIZE + FFI_PINNED_MAX_ALIGN
+        ));
+        if (slab == nullptr)
+            fail (Error_No_Memory(FFI_PINNED_SLAB_SIZE));
+
+        memcpy(slab, &Pinned_Slabs, sizeof(REBYTE*));
+        Pinned_Slabs = slab;
+
+        // Blocks of at least a cache line are cache line aligned, because
+        // the carving starts on one and they are all a multiple of it.
+        //
+        uintptr_t start = cast(uintptr_t, slab) + sizeof(REBYTE*);
+        start = (start + FFI_PINNED_MAX_ALIGN - 1)
+            & ~cast(uintptr_t, FFI_PINNED_MAX_ALIGN - 1);
+        c->slab_next = cast(REBYTE*, start);
+        c->slab_end = slab + FFI_PINNED_SLAB_SIZE + FFI_PINNED_MAX_ALIGN;
+    }
+
+    REBYTE *block = c->slab_next;
+    c->slab_next += size;
+    return block;
+}
+
+
+//
+// Give a struct pinned storage of `len` bytes aligned to `align`, copying
+// in `len` bytes from `init` (if not nullptr).
+//
+static void make_pinned_storage(
+    REBSTU *stu,
+    REBLEN len,
+    REBLEN align,
+    const REBYTE *init
+){
+    if (len == 0)
+        fail ("FFI: pinned storage can't be given to a zero-size struct");
+
+    REBLEN want = len < align ? align : len;
+
+    REBYTE *data;
+    CLEANUP_CFUNC *cleaner;
+
+    REBLEN n;
+    for (n = 0; n < FFI_PINNED_NUM_CLASSES; ++n) {
+        if (want <= PINNED_CLASS_SIZE(n))
+            break;
+    }
+
+    if (n < FFI_PINNED_NUM_CLASSES) {
+        data = Alloc_Pinned_Block(n);
+        cleaner = Pinned_Cleaners[n];
+    }
+    else {
+        REBYTE *unaligned = cast(REBYTE*, malloc(
+            len + sizeof(void*) + FFI_PINNED_MAX_ALIGN
+        ));
+        if (unaligned == nullptr)
+            fail (Error_No_Memory(len));
+
+        uintptr_t start = cast(uintptr_t, unaligned) + sizeof(void*);
+        start = (start + align - 1) & ~cast(uintptr_t, align - 1);
+        data = cast(REBYTE*, start);
+        memcpy(data - sizeof(void*), &unaligned, sizeof(void*));
+        cleaner = &cleanup_pinned_large;
+    }
+
+    if (init)
+        memcpy(data, init, len);
+    else
+        memset(data, 0, len);
+
+    Init_Handle_Cdata_Managed(ARR_SINGLE(stu), data, len, cleaner);
+}
+
+
+//
+//  Shutdown_Pinned_Storage: C
+//
+// !!! Pinned structs could still be alive at this point if anything kept
+// them, but the extension is going away--so the slabs are freed anyway.
+// (Their cleanups will see the arena is gone and leave the blocks alone.)
+//
+void Shutdown_Pinned_Storage(void)
+{
+    Pinned_Shutdown = true;
 
-        return assign_scalar(stu, field, 0, val);
+    while (Pinned_Slabs) {
+        REBYTE *slab = Pinned_Slabs;
+        memcpy(&Pinned_Slabs, slab, sizeof(REBYTE*));
+        free(slab);
     }
 
-    return false;
+    REBLEN n;
+    for (n = 0; n < FFI_PINNED_NUM_CLASSES; ++n) {
+        Pinned_Classes[n].free = nullptr;
+        Pinned_Classes[n].slab_next = nullptr;
+        Pinned_Classes[n].slab_end = nullptr;
+    }
 }
 
 
@@ -542,13 +1529,15 @@ static bool Set_Struct_Var(
 static void parse_attr(
     const RELVAL *blk,
     REBINT *raw_size,
-    uintptr_t *raw_addr
+    uintptr_t *raw_addr,
+    REBLEN *pinned  // alignment asked for with `pinned: N`, else 0
 ){
     const RELVAL *tail;
     const REBVAL *attr = SPECIFIC(VAL_ARRAY_AT(&tail, blk));
 
     *raw_size = -1;
     *raw_addr = 0;
+    *pinned = 0;
 
     while (attr != tail) {
         if (not IS_SET_WORD(attr))
@@ -606,6 +1595,25 @@ static void parse_attr(
             *raw_addr = cast(uintptr_t, addr);
             break; }
 
+          case SYM_0:  // not a core word, see if it's one of ours
+            if (not Word_Is_Spelled(attr, "pinned"))
+                fail (attr);
+
+            ++ attr;
+            if (attr == tail or not IS_INTEGER(attr))
+                fail (attr);
+            if (*pinned != 0)
+                fail ("FFI: duplicate pinned");
+            if (
+                VAL_INT64(attr) < 1
+                or VAL_INT64(attr) > FFI_PINNED_MAX_ALIGN
+                or (VAL_INT64(attr) & (VAL_INT64(attr) - 1)) != 0
+            ){
+                fail ("FFI: pinned alignment must be a power of 2 up to 64");
+            }
+            *pinned = cast(REBLEN, VAL_INT64(attr));
+            break;
+
         // !!! This alignment code was commented out for some reason.
         /*
         case SYM_ALIGNMENT:
@@ -623,6 +1631,9 @@ static void parse_attr(
 
         ++ attr;
     }
+
+    if (*pinned != 0 and *raw_addr != 0)
+        fail ("FFI: raw memory is exclusive with pinned");
 }
 
 
@@ -666,31 +1677,65 @@ static void make_ext_storage(
 }
 
 
+// libffi has no array type, but a C array of N elements has the same size,
+// alignment, and by-value ABI classification as a struct of N members of the
+// element type.  Listing every member would make `char buf[65536]` take 65536
+// entries, so instead the struct is built by halving:
 //
-//  Total_Struct_Dimensionality: C
+//     T(1) = element
+//     T(n) = struct { T(n / 2), T(n / 2) [, element if n is odd] }
 //
-// This recursively counts the total number of data elements inside of a
-// struct.  This includes for instance every array element inside a
-// nested struct's field, along with its fields.
+// This needs only one synthetic type per halving of the array's dimension.
+// If malloc() fails, Make_Array_FFType() returns nullptr, and the types it
+// made before that are left in `owned` for the caller to free.
 //
-// !!! Is this really how char[1000] would be handled in the FFI?  By
-// creating 1000 ffi_types?  :-/
-//
-static REBLEN Total_Struct_Dimensionality(REBARR *fields)
-{
-    REBLEN n_fields = 0;
+struct Reb_Array_FFType {
+    ffi_type type;  // first, so freeing the ffi_type* frees all of it
+    ffi_type *elements[4];  // two halves, maybe one element, nullptr
+};
+
+static REBLEN Num_Array_FFTypes(REBLEN dimension) {
+    REBLEN n = 0;
+    for (; dimension > 1; dimension /= 2)
+        ++n;
+    return n;
+}
 
-    RELVAL *item = ARR_HEAD(fields);
-    RELVAL *tail = ARR_TAIL(fields);
-    for (; item != tail; ++item) {
-        REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(item);
+static ffi_type *Make_Array_FFType(
+    ffi_type *element,
+    REBLEN dimension,
+    ffi_type ***owned  // each synthetic type made is appended here
+){
+    assert(dimension != 0);
+    if (dimension == 1)
+        return element;
 
-        if (FLD_IS_STRUCT(field))
-            n_fields += Total_Struct_Dimensionality(FLD_FIELDLIST(field));
-        else
-            n_fields += FLD_IS_ARRAY(field) ? FLD_DIMENSION(field) : 1;
+    ffi_type *half = Make_Array_FFType(element, dimension / 2, owned);
+    if (half == nullptr)
+        return nullptr;
+
+    struct Reb_Array_FFType *array = cast(
+        struct Reb_Array_FFType*, malloc(sizeof(struct Reb_Array_FFType))
+    );
+    if (array == nullptr)
+        return nullptr;
+
+    array->type.type = FFI_TYPE_STRUCT;
+    array->type.size = 0;  // "initialize it to zero" (libffi fills in)
+    array->type.alignment = 0;
+    array->type.elements = array->elements;
+
+    array->elements[0] = half;
+    array->elements[1] = half;
+    if (dimension % 2 == 0)
+        array->elements[2] = nullptr;
+    else {
+        array->elements[2] = element;
+        array->elements[3] = nullptr;
     }
-    return n_fields;
+
+    *(*owned)++ = &array->type;
+    return &array->type;
 }
 
 
@@ -738,35 +1783,184 @@ static void Prepare_Field_For_FFI(REBFLD *schema)
 
     REBARR *fieldlist = FLD_FIELDLIST(schema);
 
-    REBLEN dimensionality = Total_Struct_Dimensionality(fieldlist);
+    RELVAL *item;
+    RELVAL *tail = ARR_TAIL(fieldlist);
+
+    // One element per field (arrays included), and then the list of types
+    // made for array fields that this type owns (see cleanup_ffi_type()).
+    //
+    REBLEN num_owned = 0;
+    for (item = ARR_HEAD(fieldlist); item != tail; ++item) {
+        REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(item);
+        if (FLD_IS_ARRAY(field))
+            num_owned += Num_Array_FFTypes(FLD_DIMENSION(field));
+    }
+
+    REBLEN num_elements = ARR_LEN(fieldlist) + 1 + num_owned + 1;
     fftype->elements = cast(ffi_type**,
-        malloc(sizeof(ffi_type*) * (dimensionality + 1)) // nullptr term
+        malloc(sizeof(ffi_type*) * num_elements)
     );
 
-    RELVAL *item = ARR_HEAD(fieldlist);
-    RELVAL *tail = ARR_TAIL(fieldlist);
+    ffi_type **owned = fftype->elements + ARR_LEN(fieldlist) + 1;
 
     REBLEN j = 0;
-    for (; item != tail; ++item) {
+    for (item = ARR_HEAD(fieldlist); item != tail; ++item) {
         REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(item);
-        REBLEN dimension = FLD_IS_ARRAY(field) ? FLD_DIMENSION(field) : 1;
 
-        REBLEN n = 0;
-        for (n = 0; n < dimension; ++n)
+        if (not FLD_IS_ARRAY(field)) {
             fftype->elements[j++] = FLD_FFTYPE(field);
+            continue;
+        }
+
+        if (FLD_DIMENSION(field) == 0)  // zero-length arrays take no space
+            continue;
+
+        ffi_type *array = Make_Array_FFType(
+            FLD_FFTYPE(field),
+            FLD_DIMENSION(field),
+            &owned
+        );
+        if (array == nullptr) {
+            ffi_type **made = fftype->elements + ARR_LEN(fieldlist) + 1;
+            for (; made != owned; ++made)
+                free(*made);
+            free(fftype->elements);
+            free(fftype);
+            fail (Error_No_Memory(sizeof(struct Reb_Array_FFType)));
+        }
+        fftype->elements[j++] = array;
     }
 
-    fftype->elements[j] = nullptr;
+    fftype->elements[j] = nullptr;  // fewer than fields if zero length arrays
+    *owned = nullptr;
+    if (j != ARR_LEN(fieldlist)) {  // close the gap so the owned list follows
+        memmove(
+            fftype->elements + j + 1,
+            fftype->elements + ARR_LEN(fieldlist) + 1,
+            sizeof(ffi_type*) * (num_owned + 1)
+        );
+    }
 
     Init_Handle_Cdata_Managed(
         FLD_AT(schema, IDX_FIELD_FFTYPE),
         fftype,
-        dimensionality + 1,
+        num_elements,
         &cleanup_ffi_type
     );
 }
 
 
+//
+//  Init_Scalar_Field_Type: C
+//
+// Sets the type, width, and ffi_type of a field of one of the basic C types,
+// or returns false if `sym` isn't one of them.
+//
+bool Init_Scalar_Field_Type(REBFLD *field, SYMID sym)
+{
+    REBLEN wide;
+    switch (sym) {
+      case SYM_UINT8:
+      case SYM_INT8:
+        wide = 1;
+        break;
+
+      case SYM_UINT16:
+      case SYM_INT16:
+        wide = 2;
+        break;
+
+      case SYM_UINT32:
+      case SYM_INT32:
+      case SYM_FLOAT:
+        wide = 4;
+        break;
+
+      case SYM_UINT64:
+      case SYM_INT64:
+      case SYM_DOUBLE:
+        wide = 8;
+        break;
+
+      case SYM_POINTER:
+        wide = sizeof(void*);
+        break;
+
+      case SYM_REBVAL:
+        //
+        // While most data types have some kind of proxying of when you
+        // pass a Rebol value in (such as turning an INTEGER! into bits
+        // for a C `int`) if the argument is marked as being a REBVAL
+        // then the VAL_TYPE is ignored, and it acts like a pointer to
+        // the actual argument in the frame...whatever that may be.
+        //
+        // !!! The initial FFI implementation from Atronix would actually
+        // store sizeof(REBVAL) in the struct, not sizeof(REBVAL*).  The
+        // struct's binary data was then hooked into the garbage collector
+        // to make sure that cell was marked.  Because the intended use
+        // of the feature is "tunneling" a value from a routine's frame
+        // to a callback's frame, the lifetime of the REBVAL* should last
+        // for the entirety of the routine it was passed to.
+        //
+        wide = sizeof(REBVAL*);
+        break;
+
+      default:
+        return false;
+    }
+
+    Init_Word(FLD_AT(field, IDX_FIELD_TYPE), Canon(sym));
+    Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), wide);
+    Prepare_Field_For_FFI(field);
+    return true;
+}
+
+
+//
+//  Init_Struct_Field_Type: C
+//
+// Makes a field's type the struct described by `schema`.  The field borrows
+// the ffi_type* and the field index that were built for that schema.
+//
+// (What about just storing the STRUCT! value itself in the type field,
+// instead of the array of fields?)
+//
+void Init_Struct_Field_Type(REBFLD *field, REBFLD *schema, REBLEN wide)
+{
+    Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), wide);
+    Init_Block(FLD_AT(field, IDX_FIELD_TYPE), FLD_FIELDLIST(schema));
+    Copy_Cell(
+        FLD_AT(field, IDX_FIELD_FFTYPE),
+        FLD_AT(schema, IDX_FIELD_FFTYPE)
+    );
+    Copy_Cell(
+        FLD_AT(field, IDX_FIELD_INDEX),
+        FLD_AT(schema, IDX_FIELD_INDEX)
+    );
+}
+
+
+//
+//  Make_Field: C
+//
+// An unmanaged field at `offset` in its struct, with the type and dimension
+// left to be filled in.  It's GC-safe if evaluations happen before that.
+//
+REBFLD *Make_Field(const REBSTR *name, REBLEN offset)
+{
+    REBFLD *field = Make_Array(IDX_FIELD_MAX);
+    Init_Unreadable_Void(FLD_AT(field, IDX_FIELD_TYPE));
+    Init_Unreadable_Void(FLD_AT(field, IDX_FIELD_DIMENSION));
+    Init_Unreadable_Void(FLD_AT(field, IDX_FIELD_FFTYPE));
+    Init_Word(FLD_AT(field, IDX_FIELD_NAME), name);
+    Init_Integer(FLD_AT(field, IDX_FIELD_OFFSET), offset);
+    Init_Unreadable_Void(FLD_AT(field, IDX_FIELD_WIDE));
+    Init_Blank(FLD_AT(field, IDX_FIELD_INDEX));  // unless struct type
+    SET_SERIES_LEN(field, IDX_FIELD_MAX);
+    return field;
+}
+
+
 //
 // This takes a spec like `[int32 [2]]` and sets the output field's properties
 // by recognizing a finite set of FFI type keywords defined in %words.r.
@@ -789,142 +1983,34 @@ static void Parse_Field_Type_May_Fail(
     if (val == tail)
         fail ("Empty field type in FFI");
 
-    if (IS_WORD(val)) {
-        SYMID sym = VAL_WORD_ID(val);
-
-        // Initialize the type symbol with the unbound word by default (will
-        // be overwritten in the struct cases).
-        //
-        Init_Word(FLD_AT(field, IDX_FIELD_TYPE), Canon(sym));
-
-        switch (sym) {
-          case SYM_UINT8:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), 1);
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_INT8:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), 1);
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_UINT16:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), 2);
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_INT16:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), 2);
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_UINT32:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), 4);
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_INT32:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), 4);
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_UINT64:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), 8);
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_INT64:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), 8);
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_FLOAT:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), 4);
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_DOUBLE:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), 8);
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_POINTER:
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), sizeof(void*));
-            Prepare_Field_For_FFI(field);
-            break;
-
-          case SYM_STRUCT_X: {
-            ++ val;
-            if (not IS_BLOCK(val))
-                fail (Error_Unexpected_Type(REB_BLOCK, VAL_TYPE(val)));
-
-            DECLARE_LOCAL (specific);
-            Derelativize(specific, val, VAL_SPECIFIER(spec));
-            MAKE_Struct(inner, REB_CUSTOM, nullptr, specific);  // may fail()
-
-            Init_Integer(
-                FLD_AT(field, IDX_FIELD_WIDE),
-                VAL_STRUCT_DATA_LEN(inner)
-            );
-            Init_Block(
-                FLD_AT(field, IDX_FIELD_TYPE),
-                VAL_STRUCT_FIELDLIST(inner)
-            );
-
-            // Borrow the same ffi_type* that was built for the inner struct
-            // (What about just storing the STRUCT! value itself in the type
-            // field, instead of the array of fields?)
-            //
-            Copy_Cell(
-                FLD_AT(field, IDX_FIELD_FFTYPE),
-                FLD_AT(VAL_STRUCT_SCHEMA(inner), IDX_FIELD_FFTYPE)
-            );
-            break; }
+    if (IS_WORD(val) and VAL_WORD_ID(val) == SYM_STRUCT_X) {
+        ++ val;
+        if (not IS_BLOCK(val))
+            fail (Error_Unexpected_Type(REB_BLOCK, VAL_TYPE(val)));
 
-          case SYM_REBVAL: {
-            //
-            // While most data types have some kind of proxying of when you
-            // pass a Rebol value in (such as turning an INTEGER! into bits
-            // for a C `int`) if the argument is marked as being a REBVAL
-            // then the VAL_TYPE is ignored, and it acts like a pointer to
-            // the actual argument in the frame...whatever that may be.
-            //
-            // !!! The initial FFI implementation from Atronix would actually
-            // store sizeof(REBVAL) in the struct, not sizeof(REBVAL*).  The
-            // struct's binary data was then hooked into the garbage collector
-            // to make sure that cell was marked.  Because the intended use
-            // of the feature is "tunneling" a value from a routine's frame
-            // to a callback's frame, the lifetime of the REBVAL* should last
-            // for the entirety of the routine it was passed to.
-            //
-            Init_Integer(FLD_AT(field, IDX_FIELD_WIDE), sizeof(REBVAL*));
-            Prepare_Field_For_FFI(field);
-            break; }
+        DECLARE_LOCAL (specific);
+        Derelativize(specific, val, VAL_SPECIFIER(spec));
+        MAKE_Struct(inner, REB_CUSTOM, nullptr, specific);  // may fail()
 
-          default:
+        Init_Struct_Field_Type(
+            field,
+            VAL_STRUCT_SCHEMA(inner),
+            VAL_STRUCT_DATA_LEN(inner)
+        );
+    }
+    else if (IS_WORD(val)) {
+        if (not Init_Scalar_Field_Type(field, VAL_WORD_ID(val)))
             fail (Error_Invalid_Type(VAL_TYPE(val)));
-        }
     }
     else if (IS_STRUCT(val)) {
         //
         // [b: [struct-a] val-a]
         //
-        Init_Integer(
-            FLD_AT(field, IDX_FIELD_WIDE),
+        Init_Struct_Field_Type(
+            field,
+            VAL_STRUCT_SCHEMA(val),
             VAL_STRUCT_DATA_LEN(val)
         );
-        Init_Block(
-            FLD_AT(field, IDX_FIELD_TYPE),
-            VAL_STRUCT_FIELDLIST(val)
-        );
-
-        // Borrow the same ffi_type* that the struct uses, see above note
-        // regarding alternative ideas.
-        //
-        Copy_Cell(
-            FLD_AT(field, IDX_FIELD_FFTYPE),
-            FLD_AT(VAL_STRUCT_SCHEMA(val), IDX_FIELD_FFTYPE)
-        );
         Derelativize(inner, val, VAL_SPECIFIER(spec));
     }
     else
@@ -968,6 +2054,9 @@ void Init_Struct_Fields(REBVAL *ret, REBVAL *spec)
     const RELVAL *spec_tail;
     const RELVAL *spec_item = VAL_ARRAY_AT(&spec_tail, spec);
 
+    if (spec_item != spec_tail)
+        Prepare_Struct_For_Write(VAL_STRUCT(ret));
+
     while (spec_item != spec_tail) {
         const RELVAL *word;
         if (IS_BLOCK(spec_item)) { // options: raw-memory, etc
@@ -978,13 +2067,26 @@ void Init_Struct_Fields(REBVAL *ret, REBVAL *spec)
             if (VAL_LEN_HEAD(spec) != 1)
                 fail (spec);
 
-            parse_attr(spec_item, &raw_size, &raw_addr);
-            make_ext_storage(
-                VAL_STRUCT(ret),
-                VAL_STRUCT_SIZE(ret),
-                raw_size,
-                raw_addr
-            );
+            REBLEN pinned;
+            parse_attr(spec_item, &raw_size, &raw_addr, &pinned);
+
+            REBSTU *stu = VAL_STRUCT(ret);
+            if (pinned != 0) {  // move the current contents into the arena
+                make_pinned_storage(
+                    stu,
+                    STU_TOTAL_SIZE(stu),
+                    pinned,
+                    VAL_STRUCT_DATA_AT(ret)
+                );
+                STU_OFFSET(stu) = 0;
+            }
+            else
+                make_ext_storage(
+                    stu,
+                    VAL_STRUCT_SIZE(ret),
+                    raw_size,
+                    raw_addr
+                );
             break;
         }
         else {
@@ -997,68 +2099,251 @@ void Init_Struct_Fields(REBVAL *ret, REBVAL *spec)
         if (fld_val == spec_tail)
             fail (Error_Need_Non_End_Raw(rebUnrelativize(fld_val)));
 
-        REBARR *fieldlist = VAL_STRUCT_FIELDLIST(ret);
-        RELVAL *field_item = ARR_HEAD(fieldlist);
-        RELVAL *fields_tail = ARR_TAIL(fieldlist);
+        const struct Reb_Field_Access *a = Find_Struct_Field(
+            VAL_STRUCT_SCHEMA(ret),
+            VAL_WORD_SYMBOL(word)
+        );
+        if (not a)
+            fail ("FFI: field not in the parent struct");
+
+        if (a->dimension != 0) {
+            if (IS_BLOCK(fld_val)) {
+                REBLEN dimension = a->dimension;
+
+                if (VAL_LEN_AT(fld_val) != dimension)
+                    fail (rebUnrelativize(fld_val));
+
+                if (Is_Bulk_Kind(a->kind))
+                    Set_Bulk_Array_From_Cells(
+                        VAL_STRUCT_DATA_AT(ret) + a->offset,
+                        a,
+                        VAL_ARRAY_AT_HEAD(fld_val, 0),
+                        dimension
+                    );
+                else {
+                    REBLEN n = 0;
+                    for (n = 0; n < dimension; ++n) {
+                        if (not assign_scalar(
+                            VAL_STRUCT(ret),
+                            a,
+                            n,
+                            SPECIFIC(VAL_ARRAY_AT_HEAD(fld_val, n))
+                        )){
+                            fail (rebUnrelativize(fld_val));
+                        }
+                    }
+                }
+            }
+            else if (
+                Is_Packed_Array_Field(a)
+                and (IS_VECTOR(fld_val) or IS_BINARY(fld_val))
+            ){
+                if (not Set_Packed_Array(
+                    VAL_STRUCT_DATA_AT(ret) + a->offset,
+                    a,
+                    SPECIFIC(fld_val)
+                )){
+                    fail (rebUnrelativize(fld_val));
+                }
+            }
+            else if (IS_INTEGER(fld_val)) { // interpret as a data pointer
+                void *ptr = cast(void *,
+                    cast(intptr_t, VAL_INT64(fld_val))
+                );
+
+                // assuming valid pointer to enough space
+                memcpy(
+                    VAL_STRUCT_DATA_HEAD(ret) + a->offset,
+                    ptr,
+                    a->wide * a->dimension
+                );
+            }
+            else
+                fail (rebUnrelativize(fld_val));
+        }
+        else {
+            if (not assign_scalar(
+                VAL_STRUCT(ret),
+                a,
+                0,
+                SPECIFIC(fld_val)
+            )){
+                fail (rebUnrelativize(fld_val));
+            }
+        }
+
+        spec_item += 2;
+    }
+}
+
+
+// Programs tend to make the same struct over and over--e.g. a function that
+// does `make struct! [...]` every time it is called.  Rather than build a
+// new schema (and malloc a new ffi_type) each time, schemas are interned by
+// their layout: the name, type, and dimension of every field.  Nested struct
+// types are interned first, so comparing them is just comparing fieldlists.
+//
+// The table is direct-mapped and holds each schema with an API handle, so it
+// keeps at most FFI_SCHEMA_INTERN_SIZE schemas alive.  A colliding layout
+// just evicts the old entry (structs using it keep it alive on their own).
+//
+#define FFI_SCHEMA_INTERN_SIZE 512  // must be a power of 2
+
+static REBVAL *Schema_Intern[FFI_SCHEMA_INTERN_SIZE];
+
+inline static uintptr_t Mix_Schema_Hash(uintptr_t hash, uintptr_t u) {
+    hash ^= u + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+static uintptr_t Hash_Fieldlist(REBARR *fieldlist)
+{
+    uintptr_t hash = ARR_LEN(fieldlist);
+
+    RELVAL *item = ARR_HEAD(fieldlist);
+    RELVAL *tail = ARR_TAIL(fieldlist);
+    for (; item != tail; ++item) {
+        REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(item);
+
+        hash = Mix_Schema_Hash(hash, cast(uintptr_t, FLD_NAME(field)));
+        if (FLD_IS_STRUCT(field))
+            hash = Mix_Schema_Hash(
+                hash, cast(uintptr_t, FLD_FIELDLIST(field))
+            );
+        else
+            hash = Mix_Schema_Hash(hash, FLD_TYPE_SYM(field));
+
+        if (FLD_IS_ARRAY(field))
+            hash = Mix_Schema_Hash(hash, FLD_DIMENSION(field));
+    }
+
+    return hash;
+}
+
+// Do two fieldlists describe the same layout with the same names?  (Unlike
+// same_fields(), this is a shallow check--nested structs must be the very
+// same fieldlist, which they will be if they were interned.)
+//
+static bool Same_Layout(REBARR *a, REBARR *b)
+{
+    if (ARR_LEN(a) != ARR_LEN(b))
+        return false;
+
+    RELVAL *a_item = ARR_HEAD(a);
+    RELVAL *b_item = ARR_HEAD(b);
+    RELVAL *a_tail = ARR_TAIL(a);
+    for (; a_item != a_tail; ++a_item, ++b_item) {
+        REBFLD *a_field = VAL_ARRAY_KNOWN_MUTABLE(a_item);
+        REBFLD *b_field = VAL_ARRAY_KNOWN_MUTABLE(b_item);
 
-        for (; field_item != fields_tail; ++field_item) {
-            REBFLD *field = VAL_ARRAY_KNOWN_MUTABLE(field_item);
+        if (FLD_NAME(a_field) != FLD_NAME(b_field))
+            return false;
+
+        if (FLD_IS_STRUCT(a_field)) {
+            if (not FLD_IS_STRUCT(b_field))
+                return false;
+            if (FLD_FIELDLIST(a_field) != FLD_FIELDLIST(b_field))
+                return false;
+        }
+        else {
+            if (FLD_IS_STRUCT(b_field))
+                return false;
+            if (FLD_TYPE_SYM(a_field) != FLD_TYPE_SYM(b_field))
+                return false;
+        }
+
+        if (FLD_IS_ARRAY(a_field)) {
+            if (not FLD_IS_ARRAY(b_field))
+                return false;
+            if (FLD_DIMENSION(a_field) != FLD_DIMENSION(b_field))
+                return false;
+        }
+        else if (FLD_IS_ARRAY(b_field))
+            return false;
+    }
+
+    return true;
+}
+
+
+//
+//  Intern_Schema: C
+//
+// Takes an unmanaged struct schema whose fieldlist and size are filled in.
+// If an equivalent schema was interned, the new one is freed and the old one
+// returned.  Otherwise the new schema gets its ffi_type and field index, is
+// managed, and becomes the interned schema for its layout.
+//
+static REBFLD *Intern_Schema(REBFLD *schema)
+{
+    assert(NOT_SERIES_FLAG(schema, MANAGED));
+
+    REBARR *fieldlist = FLD_FIELDLIST(schema);
+    REBLEN slot = Hash_Fieldlist(fieldlist) & (FFI_SCHEMA_INTERN_SIZE - 1);
+
+    REBVAL *interned = Schema_Intern[slot];
+    if (interned) {
+        REBFLD *existing = VAL_ARRAY_KNOWN_MUTABLE(interned);
+        if (
+            FLD_WIDE(existing) == FLD_WIDE(schema)
+            and Same_Layout(FLD_FIELDLIST(existing), fieldlist)
+        ){
+            Free_Unmanaged_Series(schema);  // fieldlist is managed, GC'd
+            return existing;
+        }
+        rebRelease(interned);  // evict, structs using it keep it alive
+        Schema_Intern[slot] = nullptr;
+    }
+
+    Prepare_Field_For_FFI(schema);
+    Init_Field_Index(schema);
+    Manage_Series(schema);
 
-            if (FLD_NAME(field) != VAL_WORD_SYMBOL(word))
-                continue;
+    REBVAL *cell = Init_Block(Alloc_Value(), schema);
+    rebUnmanage(cell);
+    Schema_Intern[slot] = cell;
 
-            if (FLD_IS_ARRAY(field)) {
-                if (IS_BLOCK(fld_val)) {
-                    REBLEN dimension = FLD_DIMENSION(field);
+    return schema;
+}
 
-                    if (VAL_LEN_AT(fld_val) != dimension)
-                        fail (rebUnrelativize(fld_val));
 
-                    REBLEN n = 0;
-                    for (n = 0; n < dimension; ++n) {
-                        if (not assign_scalar(
-                            VAL_STRUCT(ret),
-                            field,
-                            n,
-                            SPECIFIC(VAL_ARRAY_AT_HEAD(fld_val, n))
-                        )){
-                            fail (rebUnrelativize(fld_val));
-                        }
-                    }
-                }
-                else if (IS_INTEGER(fld_val)) { // interpret as a data pointer
-                    void *ptr = cast(void *,
-                        cast(intptr_t, VAL_INT64(fld_val))
-                    );
+//
+//  Make_Struct_Schema: C
+//
+// Every struct has a "schema"--this is a description (potentially
+// hierarchical) of its fields, including any nested structs.  The schema
+// should be shared between common instances of the same struct, so this
+// gives back the interned schema for the layout if there is one.
+//
+REBFLD *Make_Struct_Schema(REBARR *fieldlist, REBLEN size)
+{
+    assert(GET_SERIES_FLAG(fieldlist, MANAGED));
 
-                    // assuming valid pointer to enough space
-                    memcpy(
-                        VAL_STRUCT_DATA_HEAD(ret) + FLD_OFFSET(field),
-                        ptr,
-                        FLD_LEN_BYTES_TOTAL(field)
-                    );
-                }
-                else
-                    fail (rebUnrelativize(fld_val));
-            }
-            else {
-                if (not assign_scalar(
-                    VAL_STRUCT(ret),
-                    field,
-                    0,
-                    SPECIFIC(fld_val)
-                )){
-                    fail (rebUnrelativize(fld_val));
-                }
-            }
-            goto next_spec_pair;
-        }
+    REBFLD *schema = Make_Array(IDX_FIELD_MAX);
+    Init_Block(FLD_AT(schema, IDX_FIELD_TYPE), fieldlist);
+    Init_Blank(FLD_AT(schema, IDX_FIELD_DIMENSION));  // not making an array
+    Init_Unreadable_Void(FLD_AT(schema, IDX_FIELD_FFTYPE));  // interning does
+    Init_Blank(FLD_AT(schema, IDX_FIELD_NAME));  // no symbol for structs
+    Init_Blank(FLD_AT(schema, IDX_FIELD_OFFSET));  // the offset is not used
+    Init_Integer(FLD_AT(schema, IDX_FIELD_WIDE), size);
+    Init_Unreadable_Void(FLD_AT(schema, IDX_FIELD_INDEX));  // interning does
+    SET_SERIES_LEN(schema, IDX_FIELD_MAX);
 
-        fail ("FFI: field not in the parent struct");
+    return Intern_Schema(schema);  // may give back an existing schema
+}
 
-      next_spec_pair:
 
-        spec_item += 2;
+//
+//  Shutdown_Struct_Interning: C
+//
+void Shutdown_Struct_Interning(void)
+{
+    REBLEN n;
+    for (n = 0; n < FFI_SCHEMA_INTERN_SIZE; ++n) {
+        if (Schema_Intern[n]) {
+            rebRelease(Schema_Intern[n]);
+            Schema_Intern[n] = nullptr;
+        }
     }
 }
 
@@ -1094,25 +2379,6 @@ REB_R MAKE_Struct(
 
     REBINT max_fields = 16;
 
-//
-// SET UP SCHEMA
-//
-    // Every struct has a "schema"--this is a description (potentially
-    // hierarchical) of its fields, including any nested structs.  The
-    // schema should be shared between common instances of the same struct.
-    //
-    // Though the schema is not managed until the end of this creation, the
-    // MAKE process runs evaluations, so the fields must be GC valid.
-    //
-    REBFLD *schema = Make_Array(IDX_FIELD_MAX);
-    Init_Unreadable_Void(FLD_AT(schema, IDX_FIELD_TYPE));  // will fill in
-    Init_Blank(FLD_AT(schema, IDX_FIELD_DIMENSION));  // not making an array
-    Init_Unreadable_Void(FLD_AT(schema, IDX_FIELD_FFTYPE));  // will fill in
-    Init_Blank(FLD_AT(schema, IDX_FIELD_NAME));  // no symbol for structs
-    Init_Blank(FLD_AT(schema, IDX_FIELD_OFFSET));  // the offset is not used
-    Init_Unreadable_Void(FLD_AT(schema, IDX_FIELD_WIDE));  // will fill in
-    SET_SERIES_LEN(schema, IDX_FIELD_MAX);
-
 //
 // PROCESS FIELDS
 //
@@ -1121,6 +2387,7 @@ REB_R MAKE_Struct(
 
     REBINT raw_size = -1;
     uintptr_t raw_addr = 0;
+    REBLEN pinned = 0;
 
     if (NOT_END(f_value) and IS_BLOCK(f_value)) {
         //
@@ -1131,7 +2398,7 @@ REB_R MAKE_Struct(
         //
         DECLARE_LOCAL (specific);
         Derelativize(specific, f_value, VAL_SPECIFIER(arg));
-        parse_attr(specific, &raw_size, &raw_addr);
+        parse_attr(specific, &raw_size, &raw_addr, &pinned);
         Fetch_Next_Forget_Lookback(f);
     }
 
@@ -1152,18 +2419,6 @@ REB_R MAKE_Struct(
 
     while (NOT_END(f_value)) {
 
-        // Add another field...although we don't manage the array (so it won't
-        // get GC'd) we do run evaluations, so it must be GC-valid.
-
-        REBFLD *field = Make_Array(IDX_FIELD_MAX);
-        Init_Unreadable_Void(FLD_AT(field, IDX_FIELD_TYPE));
-        Init_Unreadable_Void(FLD_AT(field, IDX_FIELD_DIMENSION));
-        Init_Unreadable_Void(FLD_AT(field, IDX_FIELD_FFTYPE));
-        Init_Unreadable_Void(FLD_AT(field, IDX_FIELD_NAME));
-        Init_Integer(FLD_AT(field, IDX_FIELD_OFFSET), offset);
-        Init_Unreadable_Void(FLD_AT(field, IDX_FIELD_WIDE));
-        SET_SERIES_LEN(field, IDX_FIELD_MAX);
-
         // Must be a word or a set-word, with set-words initializing
 
         bool expect_init;
@@ -1179,7 +2434,10 @@ REB_R MAKE_Struct(
         else
             fail (Error_Invalid_Type(VAL_TYPE(f_value)));
 
-        Init_Word(FLD_AT(field, IDX_FIELD_NAME), VAL_WORD_SYMBOL(f_value));
+        // Add another field...although we don't manage the array (so it won't
+        // get GC'd) we do run evaluations, so it must be GC-valid.
+        //
+        REBFLD *field = Make_Field(VAL_WORD_SYMBOL(f_value), offset);
 
         Fetch_Next_Forget_Lookback(f);
         if (IS_END(f_value) or not IS_BLOCK(f_value))
@@ -1191,6 +2449,9 @@ REB_R MAKE_Struct(
         //
         Parse_Field_Type_May_Fail(field, spec, init);
 
+        struct Reb_Field_Access access;  // schema isn't indexed yet
+        Init_Field_Access(&access, field);
+
         REBLEN dimension = FLD_IS_ARRAY(field) ? FLD_DIMENSION(field) : 1;
         Fetch_Next_Forget_Lookback(f);
 
@@ -1243,6 +2504,18 @@ REB_R MAKE_Struct(
                         FLD_LEN_BYTES_TOTAL(field)
                     );
                 }
+                else if (
+                    Is_Packed_Array_Field(&access)
+                    and (IS_VECTOR(init) or IS_BINARY(init))
+                ){
+                    if (not Set_Packed_Array(
+                        SER_AT(REBYTE, data_bin, cast(REBLEN, offset)),
+                        &access,
+                        init
+                    )){
+                        fail (init);
+                    }
+                }
                 else if (IS_BLOCK(init)) {
                     REBLEN n = 0;
 
@@ -1254,7 +2527,7 @@ REB_R MAKE_Struct(
                         if (not assign_scalar_core(
                             BIN_HEAD(data_bin),
                             offset,
-                            field,
+                            &access,
                             n,
                             SPECIFIC(VAL_ARRAY_AT_HEAD(init, n))
                         )){
@@ -1268,7 +2541,7 @@ REB_R MAKE_Struct(
             else {
                 // scalar
                 if (not assign_scalar_core(
-                    BIN_HEAD(data_bin), offset, field, 0, init
+                    BIN_HEAD(data_bin), offset, &access, 0, init
                 )) {
                     fail ("FFI: Failed to assign scalar value");
                 }
@@ -1317,10 +2590,7 @@ REB_R MAKE_Struct(
 
     REBARR *fieldlist = Pop_Stack_Values_Core(dsp_orig, NODE_FLAG_MANAGED);
 
-    Init_Block(FLD_AT(schema, IDX_FIELD_TYPE), fieldlist);
-    Prepare_Field_For_FFI(schema);
-
-    Init_Integer(FLD_AT(schema, IDX_FIELD_WIDE), offset); // total size known
+    REBFLD *schema = Make_Struct_Schema(fieldlist, offset);  // size known
 
 //
 // FINALIZE VALUE
@@ -1329,8 +2599,8 @@ REB_R MAKE_Struct(
     REBSTU *stu = Alloc_Singular(
         NODE_FLAG_MANAGED | SERIES_FLAG_LINK_NODE_NEEDS_MARK
     );
-    Manage_Series(schema);
     mutable_LINK(Schema, stu) = schema;
+    STU_OFFSET(stu) = 0;
 
     if (raw_addr) {
         make_ext_storage(
@@ -1340,6 +2610,15 @@ REB_R MAKE_Struct(
             raw_addr
         );
     }
+    else if (pinned != 0) {  // fields were built up in the binary, move them
+        make_pinned_storage(
+            stu,
+            FLD_LEN_BYTES_TOTAL(schema),
+            pinned,
+            BIN_HEAD(data_bin)
+        );
+        Free_Unmanaged_Series(data_bin);
+    }
     else {
         TERM_BIN(data_bin);
         Init_Binary(ARR_SINGLE(stu), data_bin);
@@ -1372,6 +2651,28 @@ REB_R PD_Struct(
     REBSTU *stu = VAL_STRUCT(pvs->out);
     fail_if_non_accessible(stu);
 
+    if (STU_IS_ARRAY(stu)) {
+        //
+        // Struct arrays are indexed by position, e.g. `points/10/x`.  The
+        // element comes back as a view on the array's data, so setting a
+        // field through it updates the array.
+        //
+        if (not IS_INTEGER(picker))
+            return R_UNHANDLED;
+
+        REBINT n = VAL_INT32(picker);
+        if (n < 1 or cast(REBLEN, n) > STU_ARRAY_LEN(stu))
+            return R_UNHANDLED;
+
+        if (not setval)
+            return Init_Struct_View(pvs->out, stu, n - 1);
+
+        if (not Set_Struct_Element(stu, n - 1, unwrap(setval)))
+            return R_UNHANDLED;
+
+        return R_INVISIBLE;
+    }
+
     if (not IS_WORD(picker))
         return R_UNHANDLED;
 
@@ -1399,7 +2700,11 @@ REB_R PD_Struct(
         //
         if (
             PVS_IS_SET_PATH(pvs)
-            and IS_BLOCK(pvs->out)
+            and (
+                IS_BLOCK(pvs->out)
+                or IS_VECTOR(pvs->out)  // packed array field (BINARY! too)
+                or IS_BINARY(pvs->out)
+            )
             and IS_END(pvs->feed->value + 1)
         ) {
             // !!! This is dodgy; it has to copy (as picker is a pointer to
@@ -1477,47 +2782,406 @@ REBINT CT_Struct(REBCEL(const*) a, REBCEL(const*) b, bool strict)
         and CELL_CUSTOM_TYPE(a) == EG_Struct_Type
         and CELL_CUSTOM_TYPE(b) == EG_Struct_Type
         and same_fields(VAL_STRUCT_FIELDLIST(a), VAL_STRUCT_FIELDLIST(b))
-        and VAL_STRUCT_SIZE(a) == VAL_STRUCT_SIZE(b)
+        and STU_TOTAL_SIZE(VAL_STRUCT(a)) == STU_TOTAL_SIZE(VAL_STRUCT(b))
         and not memcmp(
             VAL_STRUCT_DATA_HEAD(a),
             VAL_STRUCT_DATA_HEAD(b),
-            VAL_STRUCT_SIZE(a)
+            STU_TOTAL_SIZE(VAL_STRUCT(a))
         )
     ) ? 0 : 1;  // !!! > or < result needed, but comparison is under review
 }
 
 
+// Give a struct that is sharing the data of another the bytes it covers, in
+// a BINARY! of its own.
+//
+static void Give_Struct_Own_Data(REBSTU *stu)
+{
+    REBLEN size = STU_TOTAL_SIZE(stu);
+    REBBIN *bin = Make_Binary(size);
+    memcpy(BIN_HEAD(bin), STU_DATA_HEAD(stu) + STU_OFFSET(stu), size);
+    TERM_BIN_LEN(bin, size);
+    Init_Binary(ARR_SINGLE(stu), bin);
+    STU_OFFSET(stu) = 0;
+}
+
+
+// The list of shared copies on a struct's BINARY! (see Copy_Struct_Managed()),
+// made if it doesn't have one yet.
+//
+static REBARR *Ensure_Struct_Copies(REBBIN *bin)
+{
+    if (GET_SERIES_FLAG(bin, LINK_NODE_NEEDS_MARK))
+        return LINK(StructCopies, bin);
+
+    REBARR *copies = Make_Array(1);
+    Init_Logic(Alloc_Tail_Array(copies), false);  // address not given out
+    Manage_Series(copies);
+    mutable_LINK(StructCopies, bin) = copies;
+    SET_SERIES_FLAG(bin, LINK_NODE_NEEDS_MARK);
+    return copies;
+}
+
+
+//
+//  Unshare_Struct_Copies: C
+//
+// The data in `bin` is about to change, so the shared copies listed on it
+// get their own data.  (A copy which has since had its data replaced, e.g.
+// by pinned storage, is no longer using `bin` and is skipped.)
+//
+void Unshare_Struct_Copies(REBBIN *bin)
+{
+    assert(GET_SERIES_FLAG(bin, LINK_NODE_NEEDS_MARK));
+
+    REBARR *copies = LINK(StructCopies, bin);
+    if (VAL_LOGIC(ARR_HEAD(copies)))
+        return;  // address was given out, so it isn't shared (and stays so)
+
+    mutable_LINK(StructCopies, bin) = nullptr;
+    CLEAR_SERIES_FLAG(bin, LINK_NODE_NEEDS_MARK);
+
+    const RELVAL *tail = ARR_TAIL(copies);
+    RELVAL *item = ARR_HEAD(copies);
+    for (; item != tail; ++item) {
+        if (not IS_STRUCT(item))
+            continue;  // the LOGIC! head, or detached by Unshare_Struct_Copy()
+
+        REBSTU *copy = VAL_STRUCT(item);
+        if (VAL_NODE1(STU_DATA(copy)) == bin)
+            Give_Struct_Own_Data(copy);
+    }
+}
+
+
+//
+//  Unshare_Struct_Copy: C
+//
+// If `stu` is one of the shared copies listed on its data, give it its own
+// data (leaving any other copies sharing).
+//
+void Unshare_Struct_Copy(REBSTU *stu)
+{
+    REBBIN *bin = VAL_BINARY_KNOWN_MUTABLE(STU_DATA(stu));
+    REBARR *copies = LINK(StructCopies, bin);
+
+    const RELVAL *tail = ARR_TAIL(copies);
+    RELVAL *item = ARR_HEAD(copies);
+    for (; item != tail; ++item) {
+        if (IS_STRUCT(item) and VAL_STRUCT(item) == stu) {
+            Give_Struct_Own_Data(stu);
+            Init_Blank(item);
+            return;
+        }
+    }
+}
+
+
+//
+//  Prepare_Struct_For_Address: C
+//
+// The address of the data of `stu` is about to be given to C, which may hold
+// on to it and write through it after the call.  Any copies sharing the data
+// get their own, and if it's a BINARY! no copies will share it from now on.
+//
+void Prepare_Struct_For_Address(REBSTU *stu)
+{
+    Prepare_Struct_For_Write(stu);  // may give `stu` data of its own
+
+    REBVAL *data = STU_DATA(stu);
+    if (not IS_BINARY(data))
+        return;  // external memory, which copies never share
+
+    REBARR *copies = Ensure_Struct_Copies(VAL_BINARY_KNOWN_MUTABLE(data));
+    Init_Logic(ARR_HEAD(copies), true);
+}
+
+
 //
 //  Copy_Struct_Managed: C
 //
-REBSTU *Copy_Struct_Managed(REBSTU *src)
+// The copy covers just the bytes of the source (a sub-struct or an element
+// of a struct array is not copied along with the rest of the data around
+// it), and has an offset of 0.
+//
+// If `share` is true and the source's data is a BINARY!, the copy shares it
+// until either is written.  External memory is always copied, since what a
+// copy of it is a snapshot of can change without Rebol knowing--and so is a
+// BINARY! whose address has been given out, or that has as many copies
+// sharing it as it may (see FFI_STRUCT_SHARES_MAX).
+//
+REBSTU *Copy_Struct_Managed(REBSTU *src, bool share)
 {
     fail_if_non_accessible(src);
     assert(ARR_LEN(src) == 1);
 
-    // This doesn't copy the data out of the array, or the schema...just the
-    // value.  In fact, the schema is in the misc field and has to just be
-    // linked manually.
-    //
-    REBSTU *copy = Copy_Array_Shallow(src, SPECIFIED);
+    REBSTU *copy = Alloc_Singular(
+        NODE_FLAG_MANAGED | SERIES_FLAG_LINK_NODE_NEEDS_MARK
+    );
     mutable_LINK(Schema, copy) = LINK(Schema, src);  // share the same schema
-    MISC_STU_OFFSET(copy) = MISC_STU_OFFSET(src);  // copies offset
 
-    // Update the binary data with a copy of its sequence.
-    //
-    // !!! Note that the offset is left intact, and as written will make a
-    // copy as big as struct the instance is embedded into if nonzero offset.
+    REBVAL *data = STU_DATA(src);
+    Copy_Cell(ARR_SINGLE(copy), data);
+    STU_OFFSET(copy) = STU_OFFSET(src);
+
+    if (not share or not IS_BINARY(data)) {
+        Give_Struct_Own_Data(copy);
+        return copy;
+    }
+
+    REBBIN *bin = VAL_BINARY_KNOWN_MUTABLE(data);
+    if (Is_Struct_Data_Escaped(bin)) {
+        Give_Struct_Own_Data(copy);
+        return copy;
+    }
+
+    // Entries of copies which got data of their own since are reused, so the
+    // list doesn't grow past the copies actually sharing.
     //
-    REBBIN *bin_copy = Make_Binary(STU_DATA_LEN(src));
-    memcpy(BIN_HEAD(bin_copy), STU_DATA_HEAD(src), STU_DATA_LEN(src));
-    TERM_BIN_LEN(bin_copy, STU_DATA_LEN(src));
-    Init_Binary(ARR_SINGLE(copy), bin_copy);
+    REBARR *copies = Ensure_Struct_Copies(bin);
+    RELVAL *slot = nullptr;
+    REBLEN num_sharing = 0;
+
+    const RELVAL *tail = ARR_TAIL(copies);
+    RELVAL *item = ARR_AT(copies, 1);  // after the LOGIC! head
+    for (; item != tail; ++item) {
+        if (IS_STRUCT(item) and VAL_NODE1(STU_DATA(VAL_STRUCT(item))) == bin)
+            ++num_sharing;
+        else if (slot == nullptr)
+            slot = item;
+    }
+
+    if (num_sharing >= FFI_STRUCT_SHARES_MAX) {
+        Give_Struct_Own_Data(copy);
+        return copy;
+    }
+
+    if (slot == nullptr)
+        slot = Alloc_Tail_Array(copies);
+    Init_Struct(slot, copy);
 
-    Manage_Series(copy);
     return copy;
 }
 
 
+//
+//  Struct_Matches_Schema: C
+//
+// Can the data of a STRUCT! be used as a value laid out by `schema`?  Since
+// schemas are interned this is usually just a pointer comparison.
+//
+bool Struct_Matches_Schema(const REBVAL *stu, REBFLD *schema)
+{
+    if (VAL_STRUCT_SCHEMA(stu) == schema)
+        return true;
+
+    if (VAL_STRUCT_SIZE(stu) != FLD_WIDE(schema))
+        return false;
+
+    return same_fields(VAL_STRUCT_FIELDLIST(stu), FLD_FIELDLIST(schema));
+}
+
+
+//
+//  Init_Struct_For_Schema: C
+//
+// A struct instance with the layout of `schema`, holding a copy of `data`
+// (which must be the schema's size).
+//
+REBVAL *Init_Struct_For_Schema(
+    RELVAL *out,
+    REBFLD *schema,
+    const REBYTE *data
+){
+    REBLEN size = FLD_LEN_BYTES_TOTAL(schema);
+
+    REBSTU *stu = Alloc_Singular(
+        NODE_FLAG_MANAGED | SERIES_FLAG_LINK_NODE_NEEDS_MARK
+    );
+    mutable_LINK(Schema, stu) = schema;
+    STU_OFFSET(stu) = 0;
+
+    REBBIN *bin = Make_Binary(size);
+    memcpy(BIN_HEAD(bin), data, size);
+    TERM_BIN_LEN(bin, size);
+    Init_Binary(ARR_SINGLE(stu), bin);
+
+    return Init_Struct(out, stu);
+}
+
+
+//
+//  Init_Struct_Array: C
+//
+// Make a struct array of `count` elements with the layout of `element`, each
+// initialized with a copy of its data.  If `raw_addr` is nonzero then the
+// array is mapped onto that memory instead (and not initialized).
+//
+// A `stride` of 0 means the elements are packed together, as in a C array.
+// Otherwise it's the distance in bytes from one element to the next, which
+// can't be less than the element's size.
+//
+REBVAL *Init_Struct_Array(
+    RELVAL *out,
+    REBSTU *element,
+    REBLEN count,
+    REBLEN stride,
+    uintptr_t raw_addr
+){
+    if (STU_IS_ARRAY(element))
+        fail ("Struct arrays must be made from a single struct element");
+
+    REBFLD *elem_schema = STU_SCHEMA(element);
+    REBLEN size = FLD_WIDE(elem_schema);
+    if (stride == 0)
+        stride = size;
+    else if (stride < size)
+        fail ("Struct array stride can't be less than the element's size");
+
+    uint64_t total = cast(uint64_t, stride) * cast(uint64_t, count);
+    if (total > VAL_STRUCT_LIMIT) {
+        DECLARE_LOCAL (temp);
+        Init_Integer(temp, count);
+        fail (Error_Size_Limit_Raw(temp));
+    }
+
+    // The array schema is the same as the element's except for being
+    // nameless with a dimension, so it shares the element's fieldlist,
+    // ffi_type, and field index.
+    //
+    REBFLD *schema = Make_Array_Core(
+        IDX_FIELD_MAX,
+        SERIES_FLAG_LINK_NODE_NEEDS_MARK
+    );
+    mutable_LINK(Element, schema) = elem_schema;
+    Init_Blank(FLD_AT(schema, IDX_FIELD_NAME));
+    Copy_Cell(
+        FLD_AT(schema, IDX_FIELD_TYPE),
+        FLD_AT(elem_schema, IDX_FIELD_TYPE)
+    );
+    Init_Integer(FLD_AT(schema, IDX_FIELD_DIMENSION), count);
+    Copy_Cell(
+        FLD_AT(schema, IDX_FIELD_FFTYPE),
+        FLD_AT(elem_schema, IDX_FIELD_FFTYPE)
+    );
+    Init_Blank(FLD_AT(schema, IDX_FIELD_OFFSET));  // the offset is not used
+    Init_Integer(FLD_AT(schema, IDX_FIELD_WIDE), stride);
+    Copy_Cell(
+        FLD_AT(schema, IDX_FIELD_INDEX),
+        FLD_AT(elem_schema, IDX_FIELD_INDEX)
+    );
+    SET_SERIES_LEN(schema, IDX_FIELD_MAX);
+    Manage_Series(schema);
+
+    REBSTU *stu = Alloc_Singular(
+        NODE_FLAG_MANAGED | SERIES_FLAG_LINK_NODE_NEEDS_MARK
+    );
+    mutable_LINK(Schema, stu) = schema;
+    STU_OFFSET(stu) = 0;
+
+    if (raw_addr)
+        make_ext_storage(stu, cast(REBLEN, total), -1, raw_addr);
+    else {
+        fail_if_non_accessible(element);
+
+        REBBIN *data_bin = Make_Binary(cast(REBLEN, total));
+        if (stride != size)
+            memset(BIN_HEAD(data_bin), 0, cast(REBLEN, total));
+
+        const REBYTE *src = STU_DATA_HEAD(element) + STU_OFFSET(element);
+        REBLEN n;
+        for (n = 0; n < count; ++n)
+            memcpy(BIN_AT(data_bin, n * stride), src, size);
+        TERM_BIN_LEN(data_bin, cast(REBLEN, total));
+        Init_Binary(ARR_SINGLE(stu), data_bin);
+    }
+
+    return Init_Struct(out, stu);
+}
+
+
+//
+//  Init_Struct_View: C
+//
+// Make a STRUCT! for element `index` (0-based) of a struct array.  It aliases
+// the data of the array, so changes through it are changes to the array.
+//
+REBVAL *Init_Struct_View(RELVAL *out, REBSTU *array, REBLEN index)
+{
+    assert(index < STU_ARRAY_LEN(array));
+
+    REBSTU *view = Alloc_Singular(
+        NODE_FLAG_MANAGED | SERIES_FLAG_LINK_NODE_NEEDS_MARK
+    );
+    mutable_LINK(Schema, view) = STU_ELEMENT_SCHEMA(array);
+    Prepare_Struct_For_View(array);
+    Copy_Cell(ARR_SINGLE(view), STU_DATA(array));  // same BINARY! or HANDLE!
+    STU_OFFSET(view) = STU_OFFSET(array) + index * STU_ARRAY_STRIDE(array);
+
+    return Init_Struct(out, view);
+}
+
+
+//
+//  Move_Struct_View: C
+//
+// Re-aim a view made by Init_Struct_View() at another element of the array,
+// so that walking an array doesn't need an allocation per element.
+//
+void Move_Struct_View(REBSTU *view, REBSTU *array, REBLEN index)
+{
+    if (
+        STU_SCHEMA(view) != STU_ELEMENT_SCHEMA(array)
+        or VAL_NODE1(STU_DATA(view)) != VAL_NODE1(STU_DATA(array))
+    ){
+        fail ("Struct view was not made from that struct array");
+    }
+
+    if (index >= STU_ARRAY_LEN(array)) {
+        DECLARE_LOCAL (temp);
+        Init_Integer(temp, index + 1);
+        fail (Error_Out_Of_Range(temp));
+    }
+
+    STU_OFFSET(view) = STU_OFFSET(array) + index * STU_ARRAY_STRIDE(array);
+}
+
+
+//
+//  Set_Struct_Element: C
+//
+// Copy the data of a struct into element `index` (0-based) of a struct array.
+//
+static bool Set_Struct_Element(REBSTU *array, REBLEN index, const REBVAL *val)
+{
+    if (not IS_STRUCT(val))
+        return false;
+
+    REBSTU *src = VAL_STRUCT(val);
+    REBFLD *elem_schema = STU_ELEMENT_SCHEMA(array);
+    if (STU_IS_ARRAY(src) or STU_SIZE(src) != FLD_WIDE(elem_schema))
+        return false;
+
+    if (
+        STU_SCHEMA(src) != elem_schema
+        and not same_fields(STU_FIELDLIST(src), FLD_FIELDLIST(elem_schema))
+    ){
+        return false;
+    }
+
+    fail_if_non_accessible(src);
+    Prepare_Struct_For_Write(array);
+
+    memmove(  // could be a view into the same array
+        STU_DATA_HEAD(array) + STU_OFFSET(array)
+            + index * STU_ARRAY_STRIDE(array),
+        STU_DATA_HEAD(src) + STU_OFFSET(src),
+        STU_SIZE(src)
+    );
+    return true;
+}
+
+
 //
 //  REBTYPE: C
 //
@@ -1533,17 +3197,33 @@ REBTYPE(Struct)
         if (not IS_BINARY(arg))
             fail (Error_Unexpected_Type(REB_BINARY, VAL_TYPE(arg)));
 
-        if (VAL_LEN_AT(arg) != VAL_STRUCT_DATA_LEN(val))
+        REBSTU *stu = VAL_STRUCT(val);
+        if (VAL_LEN_AT(arg) != STU_TOTAL_SIZE(stu))
             fail (arg); // !!! better to fail on PAR(value)?
 
+        Prepare_Struct_For_Write(stu);
         memcpy(
-            VAL_STRUCT_DATA_HEAD(val),
-            BIN_HEAD(VAL_BINARY(arg)),
-            VAL_STRUCT_DATA_LEN(val)
+            VAL_STRUCT_DATA_AT(val),
+            VAL_BYTES_AT(nullptr, arg),
+            STU_TOTAL_SIZE(stu)
         );
         Copy_Cell(D_OUT, val);
         return D_OUT; }
 
+      case SYM_COPY: {
+        INCLUDE_PARAMS_OF_COPY;
+
+        UNUSED(PAR(value));
+        UNUSED(REF(deep));  // there are no series in the data to copy
+        if (REF(part) or REF(types))
+            fail (Error_Bad_Refines_Raw());
+
+        // Copies are often made defensively and seldom changed, so the copy
+        // shares the data until it (or the original) is written.
+        //
+        REBSTU *copy = Copy_Struct_Managed(VAL_STRUCT(val), true);
+        return Init_Struct(D_OUT, copy); }
+
       case SYM_REFLECT: {
         INCLUDE_PARAMS_OF_REFLECT;
 
@@ -1553,17 +3233,16 @@ REBTYPE(Struct)
 
         switch (property) {
         case SYM_LENGTH:
-            return Init_Integer(D_OUT, VAL_STRUCT_DATA_LEN(val));
+            if (STU_IS_ARRAY(VAL_STRUCT(val)))  // number of elements
+                return Init_Integer(D_OUT, STU_ARRAY_LEN(VAL_STRUCT(val)));
+            return Init_Integer(D_OUT, STU_TOTAL_SIZE(VAL_STRUCT(val)));
 
         case SYM_VALUES: {
             fail_if_non_accessible(VAL_STRUCT(val));
-            REBBIN *bin = Make_Binary(VAL_STRUCT_SIZE(val));
-            memcpy(
-                BIN_HEAD(bin),
-                VAL_STRUCT_DATA_AT(val),
-                VAL_STRUCT_SIZE(val)
-            );
-            TERM_BIN_LEN(bin, VAL_STRUCT_SIZE(val));
+            REBLEN size = STU_TOTAL_SIZE(VAL_STRUCT(val));
+            REBBIN *bin = Make_Binary(size);
+            memcpy(BIN_HEAD(bin), VAL_STRUCT_DATA_AT(val), size);
+            TERM_BIN_LEN(bin, size);
             return Init_Binary(D_OUT, bin); }
 
         case SYM_SPEC:
@@ -0,0 +1,147 @@
+//
+//  File: %ffi-bench.c
+//  Summary: "Known C functions for %ffi-bench.r to call"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2014-2017 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// These do as little as possible, so what the benchmarks measure is the
+// cost of getting in and out of C.  Build it next to the script with:
+//
+//     cc -O2 -shared -fPIC -o libffi-bench.so ffi-bench.c
+//
+// (or `cl /O2 /LD ffi-bench.c /Fe:ffi-bench.dll` on Windows)
+//
+
+#include <stdarg.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+    #define BENCH_API __declspec(dllexport)
+#else
+    #define BENCH_API __attribute__((visibility("default")))
+#endif
+
+
+BENCH_API void bench_void0(void) {}
+
+BENCH_API int32_t bench_add_i32(int32_t a, int32_t b)
+    { return a + b; }
+
+BENCH_API int64_t bench_add4_i64(int64_t a, int64_t b, int64_t c, int64_t d)
+    { return a + b + c + d; }
+
+BENCH_API double bench_add_f64(double a, double b)
+    { return a + b; }
+
+// A spread of argument classes, which no direct call thunk covers.
+//
+BENCH_API double bench_mix(int8_t a, uint16_t b, float c, double d, void *p)
+    { return a + b + c + d + (p ? 1 : 0); }
+
+BENCH_API int32_t bench_sum8_i32(
+    int32_t a, int32_t b, int32_t c, int32_t d,
+    int32_t e, int32_t f, int32_t g, int32_t h
+){
+    return a + b + c + d + e + f + g + h;
+}
+
+
+struct bench_point {
+    double x;
+    double y;
+};
+
+BENCH_API struct bench_point bench_scale_point(struct bench_point p, double k)
+{
+    p.x *= k;
+    p.y *= k;
+    return p;
+}
+
+struct bench_block {
+    int32_t v[16];
+};
+
+BENCH_API int32_t bench_sum_block(struct bench_block b)
+{
+    int32_t sum = 0;
+    int i;
+    for (i = 0; i < 16; ++i)
+        sum += b.v[i];
+    return sum;
+}
+
+
+// Called with `n` int32 arguments after the count.
+//
+BENCH_API int32_t bench_sum_varargs(int32_t n, ...)
+{
+    va_list va;
+    int32_t sum = 0;
+    va_start(va, n);
+    while (n-- > 0)
+        sum += va_arg(va, int32_t);
+    va_end(va);
+    return sum;
+}
+
+
+// Call a callback `n` times, so its round trip can be timed without the
+// cost of a routine call in each one.
+//
+BENCH_API int32_t bench_callback(int32_t (*cb)(int32_t), int32_t n)
+{
+    int32_t sum = 0;
+    int32_t i;
+    for (i = 0; i < n; ++i)
+        sum += cb(i);
+    return sum;
+}
+
+// The same, for a callback that finds its state from a context pointer.
+//
+BENCH_API int32_t bench_callback_ctx(
+    int32_t (*cb)(int32_t, void*),
+    void *ctx,
+    int32_t n
+){
+    int32_t sum = 0;
+    int32_t i;
+    for (i = 0; i < n; ++i)
+        sum += cb(i, ctx);
+    return sum;
+}
+
+
+// Write through a pointer that the FFI supplies, for `[out int32]`.
+//
+BENCH_API void bench_out_i32(int32_t a, int32_t *out)
+    { *out = a + 1; }
+
+// Take and return C strings, for `[utf8]` parameters and returns.
+//
+BENCH_API int32_t bench_text_len(const char *s)
+{
+    int32_t n = 0;
+    while (s[n] != '\0')
+        ++n;
+    return n;
+}
+
+BENCH_API const char *bench_text_hello(void)
+    { return "hello, world"; }
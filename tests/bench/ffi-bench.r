@@ -0,0 +1,421 @@
+Rebol [
+    Title: "Microbenchmarks for the FFI extension"
+    File: %ffi-bench.r
+
+    Description: {
+        Times the paths through the FFI that bindings spend their time on:
+        routine dispatch by arity and type mix, structs passed and returned
+        by value, variadic calls, struct field access, array fields, MAKE
+        STRUCT!, batched calls, callback round trips, and the helpers for
+        binding libraries, pointers, parameters, and struct arrays.
+
+        The C side is %ffi-bench.c, which must be built as a shared library
+        next to this script first (see the comment at its top).
+
+        Each result is printed as a tab-separated line of:
+
+            name    nanoseconds-per-operation    operations
+
+        The numbers are also written as a Rebol block to %ffi-bench.out.r
+        in the current directory, so runs on different builds can be loaded
+        and compared.  The "baseline" entries are the cost of the benchmark
+        loop itself, which is included in every other number.
+    }
+
+    Notes: {
+        Which optimization each group of entries exercises:
+
+            dispatch/*      precomputed argument layout, direct call thunks
+            by-value/*      layout stores for struct arguments and returns
+            variadic/*      variadic CIF cache (cached and uncacheable)
+            field/*         per-schema field index and unboxed field access
+            array-field/*   packed VECTOR! exchange and bulk conversion
+            make-struct/*   schema interning
+            call-many/*     CALL-MANY rows, serial and /PARALLEL
+            callback/*      reused invocation arrays, pooled closures, and
+                            closures shared through context pointers
+            profiled/*      cost of the PROFILE-FFI counters when on
+            bind/*          lazy routines of BIND-LIBRARY, FFI images
+            pointer/*       PEEK/POKE-AT-POINTER, READ/WRITE-AT-POINTER
+            out-param/*     `[out T]` pointees, instead of a struct per call
+            text/*          `[utf8]` arguments and returns
+            into/*          `<into>` results, instead of a struct per call
+            struct-array/*  FOR-EACH-STRUCT and MOVE-STRUCT-VIEW
+            copy/*          copy-on-write STRUCT! copies
+            mold/*          run-length and /LIMIT molding of big structs
+    }
+]
+
+lib: make library! join system/script/path either 3 = fourth system/version [
+    %ffi-bench.dll
+][
+    %libffi-bench.so
+]
+
+results: copy []
+
+bench: function [
+    {Time RUNS of BODY, and record the nanoseconds per operation}
+
+    name [text!]
+    runs [integer!]
+    body [block!]
+    /per "Operations done by each run of the body (default 1)"
+        [integer!]
+][
+    ops: runs * any [per 1]
+
+    start: now/precise
+    repeat i runs body
+    seconds: to decimal! difference now/precise start
+
+    ns: round/to (seconds * 1e9) / ops 0.1
+    append results reduce [name ns ops]
+    print unspaced [name tab ns tab ops]
+]
+
+runs: 100000
+
+
+;=//// BASELINE //////////////////////////////////////////////////////////=//
+
+bench "baseline/empty" runs []
+bench "baseline/native" runs [add 1 2]
+
+
+;=//// DISPATCH ///////////////////////////////////////////////////////////=//
+
+void0: make-routine lib "bench_void0" []
+
+add-i32: make-routine lib "bench_add_i32" [
+    a [int32] b [int32] return: [int32]
+]
+
+add4-i64: make-routine lib "bench_add4_i64" [
+    a [int64] b [int64] c [int64] d [int64] return: [int64]
+]
+
+add-f64: make-routine lib "bench_add_f64" [
+    a [double] b [double] return: [double]
+]
+
+mix: make-routine lib "bench_mix" [
+    a [int8] b [uint16] c [float] d [double] p [pointer] return: [double]
+]
+
+sum8: make-routine lib "bench_sum8_i32" [
+    a [int32] b [int32] c [int32] d [int32]
+    e [int32] f [int32] g [int32] h [int32]
+    return: [int32]
+]
+
+assert [3 = add-i32 1 2]
+assert [10 = add4-i64 1 2 3 4]
+assert [36 = sum8 1 2 3 4 5 6 7 8]
+
+bench "dispatch/void-0" runs [void0]
+bench "dispatch/int32-2" runs [add-i32 1 2]
+bench "dispatch/int64-4" runs [add4-i64 1 2 3 4]
+bench "dispatch/double-2" runs [add-f64 1.0 2.0]
+bench "dispatch/mixed-5" runs [mix 1 2 3.0 4.0 0]
+bench "dispatch/int32-8" runs [sum8 1 2 3 4 5 6 7 8]
+
+
+;=//// STRUCTS BY VALUE ///////////////////////////////////////////////////=//
+
+scale-point: make-routine lib "bench_scale_point" [
+    p [struct! [x [double] y [double]]]
+    k [double]
+    return: [struct! [x [double] y [double]]]
+]
+
+sum-block: make-routine lib "bench_sum_block" [
+    b [struct! [v [int32 [16]]]]
+    return: [int32]
+]
+
+point: make struct! [x [double] y [double]]
+point/x: 1.5
+point/y: 2.0
+scaled: scale-point point 2.0
+assert [scaled/x = 3.0]
+
+block: make struct! [v [int32 [16]]]
+block/v: [1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16]
+assert [136 = sum-block block]
+
+bench "by-value/point-16-bytes" runs [scale-point point 2.0]
+bench "by-value/block-64-bytes" runs [sum-block block]
+
+
+;=//// VARIADIC ///////////////////////////////////////////////////////////=//
+
+sum-varargs: make-routine lib "bench_sum_varargs" [
+    n [int32] ... return: [int32]
+]
+
+assert [6 = (sum-varargs 3 1 [int32] 2 [int32] 3 [int32])]
+
+bench "variadic/int32-1" runs [(sum-varargs 1 10 [int32])]
+bench "variadic/int32-4" runs [
+    (sum-varargs 4 1 [int32] 2 [int32] 3 [int32] 4 [int32])
+]
+
+
+;=//// FIELD ACCESS ///////////////////////////////////////////////////////=//
+
+fields-spec: function [count [integer!]] [
+    spec: copy []
+    repeat i count [
+        append spec compose [(to word! join "f" i) [int32]]
+    ]
+    spec
+]
+
+narrow: make struct! fields-spec 4
+wide: make struct! fields-spec 64
+
+bench "field/get-of-4" runs [narrow/f4]
+bench "field/set-of-4" runs [narrow/f4: 1]
+bench "field/get-of-64" runs [wide/f64]
+bench "field/set-of-64" runs [wide/f64: 1]
+bench "field/mold-of-64" 1000 [mold wide]
+
+
+;=//// ARRAY FIELDS ///////////////////////////////////////////////////////=//
+
+samples: make struct! [v [int16 [256]]]
+ints: copy []
+repeat i 256 [append ints i - 128]
+vec16: make vector! reduce ['integer! 16 256 ints]
+vec32: make vector! reduce ['integer! 32 256 ints]
+
+floats: make struct! [v [float [256]]]
+decimals: make vector! [decimal! 64 256]
+
+bench "array-field/get-int16-256" runs / 10 [samples/v]
+bench "array-field/set-int16-256-vector" runs / 10 [samples/v: vec16]
+bench "array-field/set-int16-256-from-int32" runs / 10 [samples/v: vec32]
+bench "array-field/set-int16-256-block" runs / 10 [samples/v: ints]
+bench "array-field/set-float-256-from-double" runs / 10 [
+    floats/v: decimals
+]
+
+
+;=//// MAKE STRUCT! ///////////////////////////////////////////////////////=//
+
+bench "make-struct/2-fields" runs / 10 [make struct! [x [int32] y [double]]]
+bench "make-struct/64-fields" runs / 100 [make struct! fields-spec 64]
+bench "make-struct/from-prototype" runs / 10 [make point [x: 1.0]]
+
+
+;=//// CALL-MANY //////////////////////////////////////////////////////////=//
+
+add-i32-mt: make-routine lib "bench_add_i32" [
+    <reentrant>
+    a [int32] b [int32] return: [int32]
+]
+
+rows: 10000
+column: make vector! compose [integer! 32 (rows)]
+repeat i rows [column/(i): i]
+
+bench/per "call-many/int32-2" 100 [call-many :add-i32 [column column]] rows
+bench/per "call-many/int32-2-parallel" 100 [
+    call-many/parallel :add-i32-mt [column column]
+] rows
+
+
+;=//// CALLBACKS //////////////////////////////////////////////////////////=//
+
+run-callback: make-routine lib "bench_callback" [
+    cb [pointer] n [int32] return: [int32]
+]
+
+identity: make-callback [n [int32] return: [int32]] [n]
+assert [6 = run-callback (addr-of :identity) 4]
+
+bench/per "callback/round-trip" 10 [
+    run-callback (addr-of :identity) 10000
+] 10000
+
+run-callback-ctx: make-routine lib "bench_callback_ctx" [
+    cb [pointer] ctx [pointer] n [int32] return: [int32]
+]
+
+identity-ctx: make-callback/context [
+    n [int32] ctx [pointer] return: [int32]
+] [n] 'ctx
+assert [6 = run-callback-ctx :identity-ctx callback-context :identity-ctx 4]
+
+bench/per "callback/context-round-trip" 10 [
+    run-callback-ctx :identity-ctx (callback-context :identity-ctx) 10000
+] 10000
+
+bench "callback/make" runs / 10 [
+    make-callback [n [int32] return: [int32]] [n]
+]
+bench "callback/make-context" runs / 10 [
+    make-callback/context [n [int32] ctx [pointer] return: [int32]] [n] 'ctx
+]
+
+
+;=//// PROFILING OVERHEAD /////////////////////////////////////////////////=//
+
+profile-ffi true
+bench "profiled/int32-2" runs [add-i32 1 2]
+profile-ffi false
+print ["stats of add-i32:" mold ffi-stats :add-i32]
+
+
+;=//// BINDING ////////////////////////////////////////////////////////////=//
+
+bind-specs: copy []
+repeat i 16 [
+    append bind-specs compose [
+        (to set-word! join "add" i) "bench_add_i32" [
+            a [int32] b [int32] return: [int32]
+        ]
+    ]
+]
+
+binding: bind-library lib bind-specs
+assert [3 = binding/add1 1 2]
+
+bench "bind/bind-library-16" runs / 100 [bind-library lib bind-specs]
+bench "bind/first-call" runs / 100 [
+    b: bind-library lib [add: "bench_add_i32" [a [int32] b [int32]]]
+    b/add 1 2
+]
+bench "bind/later-call" runs [binding/add1 1 2]
+
+image: save-ffi-image binding
+bench "bind/save-image-16" runs / 100 [save-ffi-image binding]
+bench "bind/load-image-16" runs / 100 [load-ffi-image image lib]
+
+
+;=//// POINTER ACCESS /////////////////////////////////////////////////////=//
+
+buffer: make struct! [v [int16 [256]]]
+address: addr-of buffer
+
+poke-at-pointer address 'int32 7
+assert [7 = peek-at-pointer address 'int32]
+
+bench "pointer/peek-int32" runs [peek-at-pointer address 'int32]
+bench "pointer/poke-int32" runs [poke-at-pointer address 'int32 7]
+bench "pointer/write-int16-256" runs / 10 [write-at-pointer address vec16]
+bench "pointer/read-int16-256" runs / 10 [read-at-pointer vec16 address]
+
+
+;=//// OUT PARAMETERS /////////////////////////////////////////////////////=//
+
+out-i32: make-routine lib "bench_out_i32" [
+    a [int32] out [out int32]
+]
+
+out-via-struct: make-routine lib "bench_out_i32" [
+    a [int32] out [pointer]
+]
+holder: make struct! [n [int32]]
+
+assert [[2] = out-i32 1]
+out-via-struct 1 holder
+assert [holder/n = 2]
+
+bench "out-param/out-int32" runs [out-i32 1]
+bench "out-param/struct-per-call" runs [
+    out-via-struct 1 (h: make struct! [n [int32]])
+    h/n
+]
+bench "out-param/reused-struct" runs [
+    out-via-struct 1 holder
+    holder/n
+]
+
+
+;=//// TEXT ///////////////////////////////////////////////////////////////=//
+
+text-len: make-routine lib "bench_text_len" [s [utf8] return: [int32]]
+text-len-ptr: make-routine lib "bench_text_len" [s [pointer] return: [int32]]
+text-hello: make-routine lib "bench_text_hello" [return: [utf8]]
+
+short-text: "hello"
+long-text: append/dup copy "" "x" 4096
+locked-text: lock copy long-text  ; passed without being copied
+
+assert [5 = text-len short-text]
+assert ["hello, world" = text-hello]
+
+bench "text/utf8-arg-5" runs [text-len short-text]
+bench "text/utf8-arg-4096" runs / 10 [text-len long-text]
+bench "text/utf8-arg-4096-locked" runs / 10 [text-len locked-text]
+bench "text/pointer-arg-5" runs [text-len-ptr short-text]
+bench "text/utf8-return" runs [text-hello]
+
+
+;=//// INTO ///////////////////////////////////////////////////////////////=//
+
+scale-point-into: make-routine lib "bench_scale_point" [
+    <into>
+    p [struct! [x [double] y [double]]]
+    k [double]
+    return: [struct! [x [double] y [double]]]
+]
+
+result: make struct! [x [double] y [double]]
+assert [result = scale-point-into point 2.0 result]
+assert [result/x = 3.0]
+
+bench "into/point-16-bytes" runs [scale-point-into point 2.0 result]
+bench "into/point-16-bytes-fresh" runs [scale-point-into point 2.0 _]
+
+
+;=//// STRUCT ARRAYS //////////////////////////////////////////////////////=//
+
+elements: 10000
+records: make-struct-array make struct! [x [int32] y [int32]] elements
+
+bench/per "struct-array/for-each-struct" 10 [
+    for-each-struct r records [r/x]
+] elements
+bench/per "struct-array/move-struct-view" 10 [
+    view: records/1
+    repeat j elements [
+        move-struct-view view records j
+        view/x
+    ]
+] elements
+bench/per "struct-array/pick-path" 10 [
+    repeat j elements [records/(j)/x]
+] elements
+
+
+;=//// COPIES /////////////////////////////////////////////////////////////=//
+
+big: make struct! [id [int32] payload [uint8 [65536]]]
+
+bench "copy/struct-64k" runs / 10 [copy big]
+bench "copy/struct-64k-then-write" runs / 100 [
+    c: copy big
+    c/id: 1
+]
+bench "copy/struct-64k-read-source" runs / 10 [
+    c: copy big
+    big/id
+]
+
+
+;=//// MOLDING ////////////////////////////////////////////////////////////=//
+
+bench "mold/struct-64k" 100 [mold big]
+bench "mold/struct-64k-limit-100" runs / 10 [mold/limit big 100]
+bench "mold/struct-array-10000" 100 [mold records]
+
+
+write %ffi-bench.out.r mold reduce [
+    'version system/version
+    'results results
+]
+
+close lib
@@ -0,0 +1,36 @@
+REBOL []
+
+recycle/torture
+
+libc: switch fourth system/version [
+    3 [
+        make library! %msvcrt.dll
+    ]
+    4 [
+        make library! %libc.so.6
+    ]
+]
+
+; Nothing is looked up in the library until a routine is first used, so
+; binding many functions at once is cheap even if most are never called.
+;
+c: bind-library libc [
+    abs: [n [int32] return: [int32]]
+    string-length: "strlen" [s [pointer] return: [uint64]]
+    not-in-libc: "no_such_function_in_libc" [return: [int32]]
+]
+
+assert [5 = c/abs -5]
+assert [3 = c/string-length "abc"]
+
+; A missing function is only an error when its routine is used, and it stays
+; an error on every later use.
+;
+assert [error? trap [c/not-in-libc]]
+assert [error? trap [c/not-in-libc]]
+
+; Taking the address binds the routine too.
+;
+assert [not zero? addr-of :c/abs]
+
+print ["bind-library:" c/abs -10]
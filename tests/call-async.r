@@ -0,0 +1,58 @@
+REBOL []
+
+recycle/torture
+
+libc: switch fourth system/version [
+    3 [
+        make library! %msvcrt.dll
+    ]
+    4 [
+        make library! %libc.so.6
+    ]
+]
+
+strlen: make-routine libc "strlen" [
+    s [pointer]
+    return: [uint64]
+]
+
+text: "Run on a worker thread"
+
+; The TEXT! is held while the C code may be reading it.
+;
+job: call-async :strlen [text]
+assert [error? trap [append text "!"]]
+
+assert [(length of text) = async-wait job]
+assert [async-ready? job]
+assert [error? trap [async-wait job]]  ; result can only be collected once
+
+append text "!"  ; no longer held
+
+jobs: map-each s ["a" "bb" "ccc"] [call-async :strlen [s]]
+lengths: map-each j jobs [async-wait j]
+assert [lengths = [1 2 3]]
+
+; qsort() on a worker calls its comparator from that thread, so it has to
+; be a /FOREIGN callback.  ASYNC-WAIT runs those while it waits, since the
+; worker won't finish until they've been answered.
+;
+size_t: either 40 = fifth system/version ['int64] ['int32]
+
+qsort: make-routine libc "qsort" compose/deep [
+    base [pointer]
+    nmemb [(size_t)]
+    size [(size_t)]
+    comp [pointer]
+]
+
+compare: make-callback/foreign [a [pointer] b [pointer] return: [int32]] [
+    (peek-at-pointer a 'int32) - (peek-at-pointer b 'int32)
+]
+
+array: make vector! [integer! 32 5 [10 8 2 9 5]]
+job: call-async :qsort [array 5 4 :compare]
+async-wait job
+assert [array = make vector! [integer! 32 5 [2 5 8 9 10]]]
+
+print ["call-async:" mold lengths]
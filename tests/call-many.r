@@ -0,0 +1,94 @@
+REBOL []
+
+recycle/torture
+
+libc: switch fourth system/version [
+    3 [
+        make library! %msvcrt.dll
+    ]
+    4 [
+        make library! %libc.so.6
+    ]
+]
+
+abs: make-routine libc "abs" [
+    "Batched calls read packed C data from each column"
+    n [int32]
+    return: [int32]
+]
+
+column: make vector! [integer! 32 5 [-10 8 -2 9 -5]]
+result: call-many :abs [column]
+assert [result = make vector! [integer! 32 5 [10 8 2 9 5]]]
+
+; A BINARY! column is the raw bytes of the C type (4 per int32 here), so
+; these are -1 and 0 regardless of the machine's byte order.
+;
+bytes: #{FFFFFFFF00000000}
+result: make vector! [integer! 32 2]
+call-many/into :abs [bytes] result
+assert [result = make vector! [integer! 32 2 [1 0]]]
+
+; A scalar instead of a column is used for every row, in either position.
+;
+ldexp: make-routine libc "ldexp" [x [double] exp [int32] return: [double]]
+
+xs: make vector! [decimal! 64 3 [1.0 1.5 -2.0]]
+result: call-many :ldexp [xs 2]
+assert [result = make vector! [decimal! 64 3 [4.0 6.0 -8.0]]]
+
+exps: make vector! [integer! 32 4 [0 1 2 3]]
+result: call-many :ldexp [1.0 exps]
+assert [result = make vector! [decimal! 64 4 [1.0 2.0 4.0 8.0]]]
+
+assert [error? trap [call-many :ldexp [xs "two"]]]
+
+; For pointer arguments a BINARY! is passed as the address of its data on
+; every row (as an ordinary call would), and only a VECTOR! of addresses is
+; a column.
+;
+size_t: either 40 = fifth system/version ['int64] ['int32]
+size-bits: either 40 = fifth system/version [64] [32]
+
+memcmp: make-routine libc "memcmp" compose [
+    a [pointer] b [pointer] n [(size_t)] return: [int32]
+]
+
+buf: #{0102030405}
+other: #{0102030905}
+sizes: make vector! compose [integer! (size-bits) 5 [1 2 3 4 5]]
+result: call-many :memcmp [buf other sizes]
+assert [all [result/1 = 0  result/2 = 0  result/3 = 0]]
+assert [result/4 < 0]
+assert [result/5 < 0]
+
+one: make struct! [b [uint8 [5]]]
+one/b: buf
+two: make struct! [b [uint8 [5]]]
+two/b: other
+addresses: make vector! compose [
+    integer! (size-bits) 2 [(addr-of one) (addr-of two)]
+]
+result: call-many :memcmp [addresses buf 5]
+assert [result/1 = 0]
+assert [result/2 > 0]
+
+; A routine that's safe to call from many threads at once can be marked so,
+; allowing the rows to be split across worker threads.
+;
+abs-mt: make-routine libc "abs" [
+    <reentrant>
+    n [int32]
+    return: [int32]
+]
+assert [error? trap [call-many/parallel :abs [column]]]
+
+count: 10000
+column: make vector! compose [integer! 32 (count)]
+repeat i count [column/(i): either even? i [i] [negate i]]
+serial: call-many :abs [column]
+parallel: call-many/parallel :abs-mt [column]
+assert [serial = parallel]
+assert [parallel/(count) = count]
+
+print ["call-many:" mold result]
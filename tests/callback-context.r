@@ -0,0 +1,68 @@
+REBOL []
+
+recycle/torture
+
+; The comparator of glibc's qsort_r() gets a `void *arg` passed through, so
+; the callback can use it as its context pointer instead of having its own
+; closure.  (Windows has qsort_s(), with the context argument first.)
+;
+libc: make library! %libc.so.6
+
+size_t: either 40 = fifth system/version ['int64] ['int32]
+
+qsort_r: make-routine libc "qsort_r" compose/deep [
+    base [pointer]
+    nmemb [(size_t)]
+    size [(size_t)]
+    comp [pointer]
+    arg [pointer]
+]
+
+make-comparator: function [sign [integer!]] [
+    make-callback/context [
+        a [pointer]
+        b [pointer]
+        ctx [pointer]
+        return: [int32]
+    ] compose/deep [
+        i: peek-at-pointer a 'int32
+        j: peek-at-pointer b 'int32
+        case [
+            i < j [(negate sign)]
+            i > j [(sign)]
+        ] else [0]
+    ] 'ctx
+]
+
+ascending: make-comparator 1
+descending: make-comparator -1
+
+; Both have the same signature, so they share one C function pointer and
+; are told apart by their context pointers.
+;
+assert [(addr-of :ascending) = (addr-of :descending)]
+assert [(callback-context :ascending) <> (callback-context :descending)]
+
+array: make vector! [integer! 32 5 [10 8 2 9 5]]
+qsort_r array 5 4 :ascending callback-context :ascending
+assert [array = make vector! [integer! 32 5 [2 5 8 9 10]]]
+
+qsort_r array 5 4 :descending callback-context :descending
+assert [array = make vector! [integer! 32 5 [10 9 8 5 2]]]
+
+; Making and dropping lots of them doesn't use up any closures.
+;
+repeat i 1000 [
+    cmp: make-comparator 1
+    qsort_r array 5 4 :cmp callback-context :cmp
+]
+assert [array = make vector! [integer! 32 5 [2 5 8 9 10]]]
+
+assert [error? trap [callback-context :qsort_r]]
+assert [error? trap [
+    wrap-callback/context func [x] [x] [x [int32]] 'x  ; must be a pointer
+]]
+
+close libc
+
+print "callback-context: ok"
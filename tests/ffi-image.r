@@ -0,0 +1,38 @@
+REBOL []
+
+recycle/torture
+
+libc: switch fourth system/version [
+    3 [
+        make library! %msvcrt.dll
+    ]
+    4 [
+        make library! %libc.so.6
+    ]
+]
+
+binding: make object! [
+    abs: make-routine libc "abs" [n [int32] return: [int32]]
+    point: make struct! [x [int32] y [int32] tag [uint8 [4]]]
+]
+binding/point/x: 10
+binding/point/y: -20
+
+; The image holds the layouts and signatures the specs produced, so loading
+; it doesn't need the specs (or the evaluation they do) again.
+;
+image: save-ffi-image binding
+loaded: load-ffi-image image libc
+
+assert [5 = loaded/abs -5]
+assert [loaded/point/x = 10]
+assert [loaded/point/y = -20]
+assert [4 = length of loaded/point/tag]
+
+; A damaged image is rejected, rather than loading something wrong.
+;
+damaged: copy image
+change skip tail damaged -1 #{FF}
+assert [error? trap [load-ffi-image damaged libc]]
+
+print ["ffi-image:" length of image "bytes"]
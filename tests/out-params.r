@@ -0,0 +1,46 @@
+REBOL []
+
+recycle/torture
+
+libc: switch fourth system/version [
+    3 [
+        make library! %msvcrt.dll
+    ]
+    4 [
+        make library! %libc.so.6
+    ]
+]
+
+; double frexp(double x, int *exp);
+;
+frexp: make-routine libc "frexp" [
+    x [double]
+    exp [out int32]
+    return: [double]
+]
+
+assert [[0.75 4] = frexp 12.0]
+assert [1 = length of parameters of :frexp]  ; `exp` isn't taken from callers
+
+; long strtol(const char *str, char **endptr, int base);
+;
+; An `inout` pointee starts out as the argument, here the address of the text
+; (which strtol() overwrites with where it stopped parsing).
+;
+strtol: make-routine libc "strtol" [
+    str [pointer]
+    endptr [inout pointer]
+    base [int32]
+    return: [int64]
+]
+
+text: "123abc"
+result: strtol text 0 10
+assert [123 = first result]
+assert [integer? second result]
+
+assert [error? trap [
+    make-routine libc "frexp" [x [double] exp [out struct! [i [int32]]]]
+]]
+
+print "out-params: ok"
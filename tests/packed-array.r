@@ -0,0 +1,40 @@
+REBOL []
+
+recycle/torture
+
+packet: make struct! [
+    id [int32]
+    counts [int16 [4]]
+    header [uint8 [4]]
+]
+packet/counts: [1 2 3 4]
+packet/header: #{CAFEBABE}
+
+; Each read of a packed array field is a VECTOR! (or BINARY!) of its own,
+; which can be changed without changing the struct.
+;
+a: packet/counts
+assert [a = make vector! [integer! 16 4 [1 2 3 4]]]
+assert [not same? a packet/counts]
+a/1: 0
+assert [packet/counts/1 = 1]
+
+header: packet/header
+append header #{00}
+assert [header = #{CAFEBABE00}]
+assert [packet/header = #{CAFEBABE}]
+
+; Writing the struct doesn't change what was read before.
+;
+packet/counts/2: 20
+assert [2 = second a]
+assert [20 = second packet/counts]
+
+; Nor does C writing through its address.
+;
+counts: packet/counts
+write-at-pointer/offset (addr-of packet) make vector! [integer! 16 1 [7]] 4
+assert [20 = second counts]
+assert [7 = first packet/counts]
+
+print "packed-array: ok"
@@ -0,0 +1,24 @@
+REBOL []
+
+recycle/torture
+
+; Pinned structs live at an address that never changes, so ADDR-OF can be
+; handed to C code that holds onto it.
+;
+s: make struct! [[pinned: 64] a [int32] b [double]]
+assert [0 = modulo addr-of s 64]
+
+s/a: 10
+s/b: 2.5
+addr: addr-of s
+recycle
+assert [addr = addr-of s]
+assert [s/a = 10]
+
+; Many small structs come from the same size-class slab
+;
+structs: collect [repeat i 1000 [keep make struct! [[pinned: 8] n [int32]]]]
+repeat i 1000 [structs/(i)/n: i]
+assert [structs/1000/n = 1000]
+
+print ["pinned-struct:" mold s]
@@ -0,0 +1,46 @@
+REBOL []
+
+recycle/torture
+
+libc: switch fourth system/version [
+    3 [
+        make library! %msvcrt.dll
+    ]
+    4 [
+        make library! %libc.so.6
+    ]
+]
+
+malloc: make-routine libc "malloc" [size [uint64] return: [pointer]]
+free: make-routine libc "free" [ptr [pointer]]
+
+p: malloc 64
+
+; Scalars are read and written the way struct fields of their type are, with
+; the same range checks.
+;
+poke-at-pointer p 'int32 -7
+poke-at-pointer/offset p 'double 2.5 8
+assert [-7 = peek-at-pointer p 'int32]
+assert [4294967289 = peek-at-pointer p 'uint32]
+assert [2.5 = peek-at-pointer/offset p 'double 8]
+assert [error? trap [poke-at-pointer p 'uint8 256]]
+assert [error? trap [peek-at-pointer p 'struct]]
+assert [error? trap [peek-at-pointer 0 'int32]]
+
+; Bulk copies go straight between the memory and the series.
+;
+squares: make vector! [integer! 16 8 [0 1 4 9 16 25 36 49]]
+end: write-at-pointer/offset p squares 16
+assert [end = (p + 16 + 16)]
+
+copied: make vector! [integer! 16 8]
+read-at-pointer/offset copied p 16
+assert [copied = squares]
+
+bytes: read-at-pointer/part (copy #{0000000000}) p 4
+assert [find [#{F9FFFFFF00} #{FFFFFFF900}] bytes]  ; either byte order
+
+free p
+
+print "pointer-access: ok"
@@ -0,0 +1,61 @@
+REBOL []
+
+recycle/torture
+
+point: make struct! [x [int32] y [int32]]
+
+points: make-struct-array point 1000
+assert [1000 = length of points]
+assert [(8 * 1000) = length of values of points]
+
+points/10/x: 20
+points/10/y: 30
+assert [points/10/x = 20]
+assert [points/11/x = 0]
+
+; A view aliases the array's memory, so writes through it are visible
+;
+p: points/500
+p/y: 1020
+assert [points/500/y = 1020]
+
+; One view can walk the whole array without allocating per element
+;
+p: points/1
+repeat i 1000 [
+    move-struct-view p points i
+    p/x: i
+]
+assert [points/1000/x = 1000]
+
+; Assigning a struct to an element copies its data in
+;
+point/x: -1
+points/2: point
+assert [points/2/x = -1]
+
+; FOR-EACH-STRUCT walks the elements with a single view, too
+;
+sum: 0
+for-each-struct pt points [sum: sum + pt/x]
+assert [sum = ((1000 * 1001) / 2) - 2 - 1]  ; points/2/x is -1
+
+; A stride lets an array be laid over records with more in them than the
+; element describes, e.g. every other int32 pair here
+;
+pairs: make-struct-array/at/stride point 500 (addr-of points) 16
+assert [pairs/2/x = points/3/x]
+count: 0
+for-each-struct pt pairs [if pt/x = 999 [count: count + 1]]
+assert [count = 1]
+
+; Only the word gets bound in the body, so the walk's own counting can't
+; capture a word of the caller's
+;
+i: 0
+index: 0
+for-each-struct pt pairs [i: i + 1  index: index + 1]
+assert [i = 500]
+assert [index = 500]
+
+print ["struct-array:" points/10/x points/500/y]
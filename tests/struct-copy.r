@@ -0,0 +1,97 @@
+REBOL []
+
+recycle/torture
+
+libc: switch fourth system/version [
+    3 [
+        make library! %msvcrt.dll
+    ]
+    4 [
+        make library! %libc.so.6
+    ]
+]
+
+; void *memset(void *s, int c, size_t n);
+;
+memset: make-routine libc "memset" [
+    s [pointer]
+    c [int32]
+    n [uint64]
+    return: [pointer]
+]
+
+config: make struct! [
+    id [int32]
+    limits [struct! [low [int32] high [int32]]]
+    table [int32 [4]]
+]
+config/id: 1
+config/limits/low: 10
+config/limits/high: 20
+config/table: [1 2 3 4]
+
+; A copy shares the data until either one is written, which must not be
+; visible through the other.
+;
+snapshot: copy config
+assert [snapshot/id = 1]
+config/id: 2
+assert [snapshot/id = 1]
+assert [config/id = 2]
+
+snapshot: copy config
+snapshot/id: 3
+assert [config/id = 2]
+
+; Writes through sub-struct views of either one count as writes.
+;
+snapshot: copy config
+config/limits/high: 30
+assert [snapshot/limits/high = 20]
+
+snapshot: copy config
+snapshot/limits/low: 5
+assert [config/limits/low = 10]
+
+; As does C writing through a pointer to the data.
+;
+snapshot: copy config
+memset config 0 length of config
+assert [4 = last snapshot/table]
+assert [0 = last config/table]
+
+; C may hold on to an address it was given and write through it later, so
+; copies made after the address is given out don't share the data.
+;
+counter: make struct! [n [int32]]
+counter/n: 1
+address: addr-of counter
+later: copy counter
+poke-at-pointer address 'int32 9
+assert [later/n = 1]
+assert [counter/n = 9]
+
+; Copies that were dropped don't pile up waiting for the next write.
+;
+settings: make struct! [id [int32] table [int32 [1024]]]
+repeat i 10000 [snapshot: copy settings]
+settings/id: 5
+assert [snapshot/id = 0]
+assert [settings/id = 5]
+
+; A copy of a sub-struct is just the bytes of it.
+;
+config/limits/high: 40
+limits: copy config/limits
+assert [(length of limits) = 8]
+assert [limits/high = 40]
+limits/low: 1
+assert [config/limits/low = 0]
+
+; MAKE-SIMILAR-STRUCT is a copy with fields changed.
+;
+other: make-similar-struct config [id: 7]
+assert [other/id = 7]
+assert [config/id = 0]
+
+print "struct-copy: ok"
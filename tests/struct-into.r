@@ -0,0 +1,45 @@
+REBOL []
+
+recycle/torture
+
+libc: switch fourth system/version [
+    3 [
+        make library! %msvcrt.dll
+    ]
+    4 [
+        make library! %libc.so.6
+    ]
+]
+
+; div_t div(int numer, int denom);
+;
+div: make-routine libc "div" [
+    <into>
+    numer [int32]
+    denom [int32]
+    return: [struct! [quot [int32] rem [int32]]]
+]
+
+; With a STRUCT! the result is written into it, and that STRUCT! returned.
+; Its schema is the same (interned) one, so checking it is cheap.
+;
+result: make struct! [quot [int32] rem [int32]]
+repeat i 10 [
+    assert [result = div (i * 7) + 3 7]
+    assert [result/quot = i]
+    assert [result/rem = 3]
+]
+
+; BLANK! makes a new STRUCT!, as a routine without <into> would.
+;
+fresh: div 17 5 _
+assert [fresh/quot = 3]
+assert [fresh/rem = 2]
+assert [result/quot = 10]
+
+assert [error? trap [div 1 1 make struct! [x [double]]]]
+assert [error? trap [
+    make-routine libc "abs" [<into> n [int32] return: [int32]]
+]]
+
+print "struct-into: ok"
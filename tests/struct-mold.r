@@ -0,0 +1,32 @@
+REBOL []
+
+recycle/torture
+
+packet: make struct! [
+    id [int32]
+    header [uint8 [4]]
+    counts [int16 [64]]
+    payload [uint8 [65536]]
+]
+packet/id: 7
+packet/header: #{CAFEBABE}
+packet/counts/1: 3
+
+text: mold packet
+assert [find text "id: [int32 7]"]
+assert [find text "header: [uint8 [4] #{CAFEBABE}]"]
+
+; Runs of the same element are only shown once.
+;
+assert [find text "counts: [int16 [64] [3 0 <repeats 63 times>]]"]
+
+; A limit stops the mold early, instead of doing the whole 64K of payload.
+;
+text: mold/limit packet 100
+assert [(length of text) <= 103]  ; may have "..." added
+assert [find text "id: [int32 7]"]
+
+points: make-struct-array make struct! [x [int32] y [int32]] 100
+assert [find mold points "[[x: [int32 0] y: [int32 0]] <repeats 100 times>]"]
+
+print "struct-mold: ok"
@@ -0,0 +1,59 @@
+REBOL []
+
+recycle/torture
+
+libc: switch fourth system/version [
+    3 [
+        make library! %msvcrt.dll
+    ]
+    4 [
+        make library! %libc.so.6
+    ]
+]
+
+strlen: make-routine libc "strlen" [s [utf8] return: [uint64]]
+
+assert [5 = strlen "hello"]
+assert [5 = strlen "café"]  ; counts UTF-8 bytes, not codepoints
+
+; An immutable TEXT! is passed without being copied.
+;
+greeting: lock copy "hello there"
+repeat i 3 [assert [11 = strlen greeting]]
+
+; A string the caller owns is decoded, then given to the routine the spec
+; says frees it.  That has to be the library's own free(), not whatever the
+; extension was built with.
+;
+if 4 = fourth system/version [
+    libc-free: make-routine libc "free" [p [pointer]]
+    strdup: make-routine libc "strdup" compose/deep [
+        s [utf8]
+        return: [utf8 free (:libc-free)]
+    ]
+    assert ["naïve" = strdup "naïve"]
+]
+
+assert [error? trap [make-routine libc "strlen" [return: [utf8 free]]]]
+assert [error? trap [
+    make-routine libc "strlen" compose/deep [
+        return: [utf8 free (func [p] [])]  ; must be a routine
+    ]
+]]
+
+strchr: make-routine libc "strchr" [s [utf8] c [int32] return: [utf8]]
+assert [null? strchr "abc" to integer! #"z"]
+
+if 3 = fourth system/version [  ; wchar_t is UTF-16 on Windows
+    wcslen: make-routine libc "wcslen" [s [utf16] return: [uint64]]
+
+    assert [5 = wcslen "hello"]
+    assert [2 = wcslen "😀"]  ; a surrogate pair
+
+    frozen: lock copy "wide"
+    repeat i 3 [assert [4 = wcslen frozen]]  ; converted once
+]
+
+assert [error? trap [make-routine libc "strlen" [s [utf8 free]]]]
+
+print "text-params: ok"